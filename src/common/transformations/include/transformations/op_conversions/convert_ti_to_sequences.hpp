@@ -16,6 +16,7 @@ class TRANSFORMATIONS_API ConvertTensorIteratorToLSTMSequence;
 class TRANSFORMATIONS_API ConvertTensorIteratorToRNNSequence;
 class TRANSFORMATIONS_API ConvertTensorIteratorToGRUSequence;
 class TRANSFORMATIONS_API ConvertTensorIteratorToSequence;
+class TRANSFORMATIONS_API ConvertUnrolledCellsToSequence;
 
 }  // namespace pass
 }  // namespace ov
@@ -24,6 +25,8 @@ class TRANSFORMATIONS_API ConvertTensorIteratorToSequence;
  * @ingroup ie_transformation_common_api
  * @brief Finds all TensorIterator layers, detects the pattern Squeeze->LSTMCell->Unsqueeze in the TensorIterator body,
  * converts this pattern to LSTMSequence layer and replaces them TensorIterator.
+ * Loop layers with such body are converted too if the trip count is the constant length of the sliced input
+ * and the execution condition is constant true.
  */
 
 class ov::pass::ConvertTensorIteratorToLSTMSequence : public ov::pass::MatcherPass {
@@ -36,6 +39,8 @@ public:
  * @ingroup ie_transformation_common_api
  * @brief Finds all TensorIterator layers, detects the pattern Squeeze->RNNCell->Unsqueeze in the TensorIterator body,
  * converts this pattern to RNNSequence layer and replaces them TensorIterator.
+ * Loop layers with such body are converted too if the trip count is the constant length of the sliced input
+ * and the execution condition is constant true.
  */
 
 class ov::pass::ConvertTensorIteratorToRNNSequence : public ov::pass::MatcherPass {
@@ -48,6 +53,8 @@ public:
  * @ingroup ie_transformation_common_api
  * @brief Finds all TensorIterator layers, detects the pattern Squeeze->GRUCell->Unsqueeze in the TensorIterator body,
  * converts this pattern to GRUSequence layer and replaces them TensorIterator.
+ * Loop layers with such body are converted too if the trip count is the constant length of the sliced input
+ * and the execution condition is constant true.
  */
 
 class ov::pass::ConvertTensorIteratorToGRUSequence : public ov::pass::MatcherPass {
@@ -61,3 +68,18 @@ public:
     OPENVINO_RTTI("ConvertTensorIteratorToSequence", "0");
     ConvertTensorIteratorToSequence();
 };
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief Finds the chains of the same LSTMCell/GRUCell/RNNCell layers unrolled over the time steps: each cell takes
+ * the hidden (and cell) state of the previous one, the weights are shared and the inputs are squeezed from the
+ * consecutive outputs of one Split along the time axis. Replaces the chain by the sequence layer, so the input
+ * projection of all the time steps is computed at once. The intermediate hidden states consumed outside the chain
+ * are sliced from the sequence output.
+ */
+
+class ov::pass::ConvertUnrolledCellsToSequence : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ConvertUnrolledCellsToSequence", "0");
+    ConvertUnrolledCellsToSequence();
+};
@@ -4,6 +4,8 @@
 
 #include "transformations/op_conversions/convert_ti_to_sequences.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/node.hpp>
@@ -18,7 +20,177 @@
 #include "transformations/utils/utils.hpp"
 
 namespace {
-bool convertTensorIteratorToSequence(const std::shared_ptr<ov::opset5::TensorIterator>& ti,
+std::shared_ptr<ngraph::Node> create_sequence(const std::shared_ptr<ov::op::util::RNNCellBase>& found_cell,
+                                              const ngraph::Output<ngraph::Node>& X,
+                                              const ngraph::Output<ngraph::Node>& initial_hidden_state,
+                                              const std::shared_ptr<ngraph::Node>& initial_cell_state,
+                                              const ngraph::Output<ngraph::Node>& seq_lengths,
+                                              const ngraph::Output<ngraph::Node>& W,
+                                              const ngraph::Output<ngraph::Node>& R,
+                                              const ngraph::Output<ngraph::Node>& B,
+                                              ngraph::op::RecurrentSequenceDirection direction) {
+    std::shared_ptr<ngraph::Node> sequence;
+    if (ngraph::is_type<ov::opset5::LSTMCell>(found_cell) || ngraph::is_type<ov::opset1::LSTMCell>(found_cell)) {
+        sequence =
+            std::make_shared<ov::opset5::LSTMSequence>(X,
+                                                       initial_hidden_state,
+                                                       initial_cell_state,
+                                                       seq_lengths,
+                                                       W,
+                                                       R,
+                                                       B,
+                                                       found_cell->get_hidden_size(),
+                                                       direction,
+                                                       found_cell->get_activations_alpha(),
+                                                       found_cell->get_activations_beta(),
+                                                       found_cell->get_activations(),
+                                                       found_cell->get_clip());
+    } else if (ngraph::is_type<ov::opset5::RNNCell>(found_cell)) {
+        sequence =
+            std::make_shared<ov::opset5::RNNSequence>(X,
+                                                      initial_hidden_state,
+                                                      seq_lengths,
+                                                      W,
+                                                      R,
+                                                      B,
+                                                      found_cell->get_hidden_size(),
+                                                      direction,
+                                                      found_cell->get_activations(),
+                                                      found_cell->get_activations_alpha(),
+                                                      found_cell->get_activations_beta(),
+                                                      found_cell->get_clip());
+    } else if (ngraph::is_type<ov::opset5::GRUCell>(found_cell)) {
+        const auto gru_cell = ngraph::as_type_ptr<ov::opset5::GRUCell>(found_cell);
+        sequence =
+            std::make_shared<ov::opset5::GRUSequence>(X,
+                                                      initial_hidden_state,
+                                                      seq_lengths,
+                                                      W,
+                                                      R,
+                                                      B,
+                                                      gru_cell->get_hidden_size(),
+                                                      direction,
+                                                      gru_cell->get_activations(),
+                                                      gru_cell->get_activations_alpha(),
+                                                      gru_cell->get_activations_beta(),
+                                                      gru_cell->get_clip(),
+                                                      gru_cell->get_linear_before_reset());
+    } else {
+        OPENVINO_THROW("Unsupported sequence type");
+    }
+    return sequence;
+}
+
+// Checks that the Loop runs exactly the number of the iterations the sliced inputs have, like TensorIterator does.
+// Returns the number of the body nodes which compute the execution condition.
+bool is_supported_loop(const std::shared_ptr<ov::op::util::SubGraphOp>& op, size_t& condition_nodes) {
+    condition_nodes = 0;
+    const auto loop = ngraph::as_type_ptr<ov::opset5::Loop>(op);
+    if (!loop)
+        return true;
+
+    const auto& special_ports = loop->get_special_body_ports();
+    if (special_ports.current_iteration_input_idx != -1 || special_ports.body_condition_output_idx < 0)
+        return false;
+
+    auto is_constant_true = [](const ngraph::Output<ngraph::Node>& output) {
+        const auto constant = ngraph::as_type_ptr<ov::opset5::Constant>(output.get_node_shared_ptr());
+        if (!constant)
+            return false;
+        const auto values = constant->cast_vector<bool>();
+        return !values.empty() && std::all_of(values.begin(), values.end(), [](bool value) {
+            return value;
+        });
+    };
+    const auto& body_results = loop->get_function()->get_results();
+    const auto body_condition = body_results[special_ports.body_condition_output_idx]->input_value(0);
+    if (!is_constant_true(loop->input_value(1)) || !is_constant_true(body_condition))
+        return false;
+
+    const auto trip_count = ngraph::as_type_ptr<ov::opset5::Constant>(loop->get_input_node_shared_ptr(0));
+    if (!trip_count || ngraph::shape_size(trip_count->get_shape()) != 1)
+        return false;
+    const auto iterations = trip_count->cast_vector<int64_t>()[0];
+    for (const auto& input_desc : loop->get_input_descriptions()) {
+        const auto slice_input = ngraph::as_type_ptr<ov::op::util::SubGraphOp::SliceInputDescription>(input_desc);
+        if (!slice_input)
+            continue;
+        const auto& slice_shape = loop->get_input_partial_shape(slice_input->m_input_index);
+        if (slice_input->m_part_size != 1 || std::abs(slice_input->m_stride) != 1 || slice_shape.rank().is_dynamic() ||
+            slice_shape[slice_input->m_axis].is_dynamic() || slice_shape[slice_input->m_axis].get_length() != iterations)
+            return false;
+    }
+    condition_nodes = 1;
+    return true;
+}
+
+bool is_same_input(const ngraph::Output<ngraph::Node>& lhs, const ngraph::Output<ngraph::Node>& rhs) {
+    if (lhs == rhs)
+        return true;
+    const auto lhs_const = ngraph::as_type_ptr<ov::opset5::Constant>(lhs.get_node_shared_ptr());
+    const auto rhs_const = ngraph::as_type_ptr<ov::opset5::Constant>(rhs.get_node_shared_ptr());
+    return lhs_const && rhs_const && lhs_const->get_element_type() == rhs_const->get_element_type() &&
+           lhs_const->get_shape() == rhs_const->get_shape() &&
+           std::memcmp(lhs_const->get_data_ptr(), rhs_const->get_data_ptr(), lhs_const->get_byte_size()) == 0;
+}
+
+// Checks that the cells compute the same function of X and the states: the type, the attributes and the weights match
+bool is_same_cell(const std::shared_ptr<ov::op::util::RNNCellBase>& lhs,
+                  const std::shared_ptr<ov::op::util::RNNCellBase>& rhs) {
+    if (lhs->get_type_info() != rhs->get_type_info() || lhs->get_input_size() != rhs->get_input_size() ||
+        lhs->get_hidden_size() != rhs->get_hidden_size() || lhs->get_clip() != rhs->get_clip() ||
+        lhs->get_activations() != rhs->get_activations() ||
+        lhs->get_activations_alpha() != rhs->get_activations_alpha() ||
+        lhs->get_activations_beta() != rhs->get_activations_beta())
+        return false;
+    const auto lhs_gru = ngraph::as_type_ptr<ov::opset5::GRUCell>(lhs);
+    if (lhs_gru &&
+        lhs_gru->get_linear_before_reset() != ngraph::as_type_ptr<ov::opset5::GRUCell>(rhs)->get_linear_before_reset())
+        return false;
+    // W, R and B are the last inputs of all the cells
+    for (size_t i = lhs->get_input_size() - 3; i < lhs->get_input_size(); ++i) {
+        if (!is_same_input(lhs->input_value(i), rhs->input_value(i)))
+            return false;
+    }
+    return true;
+}
+
+// Finds the Split output along the time axis the cell input is squeezed from
+bool get_time_step(const ngraph::Output<ngraph::Node>& cell_input,
+                   std::shared_ptr<ov::opset5::Split>& split,
+                   int64_t& time_axis,
+                   size_t& time_step) {
+    const auto squeeze = cell_input.get_node_shared_ptr();
+    if (!ngraph::is_type<ov::opset5::Squeeze>(squeeze) && !ngraph::is_type<ov::opset5::Reshape>(squeeze))
+        return false;
+    split = ngraph::as_type_ptr<ov::opset5::Split>(squeeze->get_input_node_shared_ptr(0));
+    if (!split)
+        return false;
+    const auto axis = ngraph::as_type_ptr<ov::opset5::Constant>(split->get_input_node_shared_ptr(1));
+    const auto& data_shape = split->get_input_partial_shape(0);
+    if (!axis || data_shape.rank().is_dynamic() || data_shape.rank().get_length() != 3)
+        return false;
+    time_axis = axis->cast_vector<int64_t>()[0];
+    if (time_axis < 0)
+        time_axis += 3;
+    if (time_axis != 0 && time_axis != 1)
+        return false;
+
+    // the squeeze must remove the time axis only
+    auto squeezed_shape = squeeze->get_input_partial_shape(0);
+    if (squeezed_shape.rank().is_dynamic() || squeezed_shape.rank().get_length() != 3 ||
+        !squeezed_shape[time_axis].compatible(1))
+        return false;
+    std::vector<ngraph::Dimension> dims(squeezed_shape.begin(), squeezed_shape.end());
+    dims.erase(dims.begin() + time_axis);
+    if (!squeeze->get_output_partial_shape(0).compatible(ngraph::PartialShape(dims)))
+        return false;
+
+    time_step = squeeze->input_value(0).get_index();
+    return true;
+}
+
+bool convertTensorIteratorToSequence(const std::shared_ptr<ov::op::util::SubGraphOp>& ti,
                                      const std::shared_ptr<ov::op::util::RNNCellBase>& found_cell,
                                      const ngraph::Output<ngraph::Node>& data,
                                      const ngraph::Output<ngraph::Node>& h_pattern,
@@ -30,7 +202,7 @@ bool convertTensorIteratorToSequence(const std::shared_ptr<ov::opset5::TensorIte
     const auto& func = ti->get_function();
     const auto& params = func->get_parameters();
 
-    std::vector<std::shared_ptr<ov::opset5::TensorIterator::InputDescription>> ordered_in_descs(3);
+    std::vector<std::shared_ptr<ov::op::util::SubGraphOp::InputDescription>> ordered_in_descs(3);
     int64_t stride = 0, slice_axis = 0;
 
     // Remember the order of the X and initial_hidden_state (+ initial_cell_state in case of LSTM) in the TensorIterator
@@ -38,7 +210,7 @@ bool convertTensorIteratorToSequence(const std::shared_ptr<ov::opset5::TensorIte
     for (const auto& input_desc : ti->get_input_descriptions()) {
         auto param = params[input_desc->m_body_parameter_index];
         if (param == data.get_node_shared_ptr()) {
-            auto slice_input = std::dynamic_pointer_cast<ov::opset5::TensorIterator::SliceInputDescription>(input_desc);
+            auto slice_input = std::dynamic_pointer_cast<ov::op::util::SubGraphOp::SliceInputDescription>(input_desc);
             if (!slice_input)
                 return false;
 
@@ -59,14 +231,14 @@ bool convertTensorIteratorToSequence(const std::shared_ptr<ov::opset5::TensorIte
     }
 
     const auto& results = func->get_results();
-    std::vector<std::shared_ptr<ov::opset5::TensorIterator::OutputDescription>> ordered_out_descs(3);
+    std::vector<std::shared_ptr<ov::op::util::SubGraphOp::OutputDescription>> ordered_out_descs(3);
 
     // Remember the order of cell outputs in the TensorIterator
     for (const auto& output_desc : ti->get_output_descriptions()) {
         std::shared_ptr<ov::opset5::Result> res = results[output_desc->m_body_value_index];
         if (res->input_value(0) == unsqueeze_after_cell) {
             auto concat_output =
-                std::dynamic_pointer_cast<ov::opset5::TensorIterator::ConcatOutputDescription>(output_desc);
+                std::dynamic_pointer_cast<ov::op::util::SubGraphOp::ConcatOutputDescription>(output_desc);
             if (!concat_output)
                 return false;
 
@@ -115,58 +287,16 @@ bool convertTensorIteratorToSequence(const std::shared_ptr<ov::opset5::TensorIte
     auto R = ov::op::util::make_try_fold<ov::opset5::Unsqueeze>(r_pattern, axis_0);
     auto B = ov::op::util::make_try_fold<ov::opset5::Unsqueeze>(b_pattern, axis_0);
 
-    std::shared_ptr<ngraph::Node> sequence;
-    if (ngraph::is_type<ov::opset5::LSTMCell>(found_cell) || ngraph::is_type<ov::opset1::LSTMCell>(found_cell)) {
-        sequence =
-            std::make_shared<ov::opset5::LSTMSequence>(X,
-                                                       initial_hidden_state,
-                                                       initial_cell_state,
-                                                       seq_lengths,
-                                                       W,
-                                                       R,
-                                                       B,
-                                                       found_cell->get_hidden_size(),
-                                                       stride > 0 ? ngraph::op::RecurrentSequenceDirection::FORWARD
-                                                                  : ngraph::op::RecurrentSequenceDirection::REVERSE,
-                                                       found_cell->get_activations_alpha(),
-                                                       found_cell->get_activations_beta(),
-                                                       found_cell->get_activations(),
-                                                       found_cell->get_clip());
-    } else if (ngraph::is_type<ov::opset5::RNNCell>(found_cell)) {
-        sequence =
-            std::make_shared<ov::opset5::RNNSequence>(X,
-                                                      initial_hidden_state,
-                                                      seq_lengths,
-                                                      W,
-                                                      R,
-                                                      B,
-                                                      found_cell->get_hidden_size(),
-                                                      stride > 0 ? ngraph::op::RecurrentSequenceDirection::FORWARD
-                                                                 : ngraph::op::RecurrentSequenceDirection::REVERSE,
-                                                      found_cell->get_activations(),
-                                                      found_cell->get_activations_alpha(),
-                                                      found_cell->get_activations_beta(),
-                                                      found_cell->get_clip());
-    } else if (ngraph::is_type<ov::opset5::GRUCell>(found_cell)) {
-        const auto gru_cell = ngraph::as_type_ptr<ov::opset5::GRUCell>(found_cell);
-        sequence =
-            std::make_shared<ov::opset5::GRUSequence>(X,
-                                                      initial_hidden_state,
-                                                      seq_lengths,
-                                                      W,
-                                                      R,
-                                                      B,
-                                                      gru_cell->get_hidden_size(),
-                                                      stride > 0 ? ngraph::op::RecurrentSequenceDirection::FORWARD
-                                                                 : ngraph::op::RecurrentSequenceDirection::REVERSE,
-                                                      gru_cell->get_activations(),
-                                                      gru_cell->get_activations_alpha(),
-                                                      gru_cell->get_activations_beta(),
-                                                      gru_cell->get_clip(),
-                                                      gru_cell->get_linear_before_reset());
-    } else {
-        OPENVINO_THROW("Unsupported sequence type");
-    }
+    const auto sequence = create_sequence(found_cell,
+                                          X,
+                                          initial_hidden_state,
+                                          initial_cell_state,
+                                          seq_lengths,
+                                          W,
+                                          R,
+                                          B,
+                                          stride > 0 ? ngraph::op::RecurrentSequenceDirection::FORWARD
+                                                     : ngraph::op::RecurrentSequenceDirection::REVERSE);
 
     ngraph::Output<ngraph::Node> out = sequence->output(0);
     if (slice_axis == 0) {
@@ -224,11 +354,12 @@ bool convertTensorIteratorToSequence(const std::shared_ptr<ov::opset5::TensorIte
 
 ov::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSequence() {
     MATCHER_SCOPE(ConvertTensorIteratorToLSTMSequence);
-    auto tensor_iterator = pattern::wrap_type<ov::opset5::TensorIterator>();
+    auto tensor_iterator = pattern::wrap_type<ov::opset5::TensorIterator, ov::opset5::Loop>();
 
     matcher_pass_callback callback = [this](pattern::Matcher& m) {
-        auto ti = std::dynamic_pointer_cast<ov::opset5::TensorIterator>(m.get_match_root());
-        if (!ti || transformation_callback(ti))
+        auto ti = std::dynamic_pointer_cast<ov::op::util::SubGraphOp>(m.get_match_root());
+        size_t condition_nodes = 0;
+        if (!ti || transformation_callback(ti) || !is_supported_loop(ti, condition_nodes))
             return false;
 
         // create a pattern for the TensorIterator body
@@ -250,7 +381,7 @@ ov::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSequen
         ngraph::pattern::Matcher matcher(unsqueeze);
 
         bool match = false;
-        auto func = ti->get_body();
+        auto func = ti->get_function();
         for (const auto& res : func->get_results()) {
             match = matcher.match((res->get_input_source_output(0)));
             if (match)
@@ -258,7 +389,8 @@ ov::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSequen
         }
 
         // All nodes are in the TI body should be matched in pattern
-        if (!match || (matcher.get_matched_nodes().size() + func->get_results().size()) != func->get_ops().size())
+        if (!match || (matcher.get_matched_nodes().size() + func->get_results().size() + condition_nodes) !=
+                          func->get_ops().size())
             return false;
 
         const auto& pattern_map = matcher.get_pattern_value_map();
@@ -284,11 +416,12 @@ ov::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSequen
 
 ov::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequence() {
     MATCHER_SCOPE(ConvertTensorIteratorToRNNSequence);
-    auto tensor_iterator = pattern::wrap_type<ov::opset5::TensorIterator>();
+    auto tensor_iterator = pattern::wrap_type<ov::opset5::TensorIterator, ov::opset5::Loop>();
 
     matcher_pass_callback callback = [this](pattern::Matcher& m) {
-        auto ti = std::dynamic_pointer_cast<ov::opset5::TensorIterator>(m.get_match_root());
-        if (!ti || transformation_callback(ti))
+        auto ti = std::dynamic_pointer_cast<ov::op::util::SubGraphOp>(m.get_match_root());
+        size_t condition_nodes = 0;
+        if (!ti || transformation_callback(ti) || !is_supported_loop(ti, condition_nodes))
             return false;
 
         // create a pattern for the TensorIterator body
@@ -309,7 +442,7 @@ ov::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequence
         ngraph::pattern::Matcher matcher(unsqueeze);
 
         bool match = false;
-        auto func = ti->get_body();
+        auto func = ti->get_function();
         for (const auto& res : func->get_results()) {
             match = matcher.match((res->get_input_source_output(0)));
             if (match)
@@ -317,7 +450,8 @@ ov::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequence
         }
 
         // All nodes are in the TI body should be matched in pattern
-        if (!match || (matcher.get_matched_nodes().size() + func->get_results().size()) != func->get_ops().size())
+        if (!match || (matcher.get_matched_nodes().size() + func->get_results().size() + condition_nodes) !=
+                          func->get_ops().size())
             return false;
 
         const auto& pattern_map = matcher.get_pattern_value_map();
@@ -343,11 +477,12 @@ ov::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequence
 
 ov::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequence() {
     MATCHER_SCOPE(ConvertTensorIteratorToGRUSequence);
-    auto tensor_iterator = pattern::wrap_type<ov::opset5::TensorIterator>();
+    auto tensor_iterator = pattern::wrap_type<ov::opset5::TensorIterator, ov::opset5::Loop>();
 
     matcher_pass_callback callback = [this](pattern::Matcher& m) {
-        auto ti = std::dynamic_pointer_cast<ov::opset5::TensorIterator>(m.get_match_root());
-        if (!ti || transformation_callback(ti))
+        auto ti = std::dynamic_pointer_cast<ov::op::util::SubGraphOp>(m.get_match_root());
+        size_t condition_nodes = 0;
+        if (!ti || transformation_callback(ti) || !is_supported_loop(ti, condition_nodes))
             return false;
 
         // create a pattern for the TensorIterator body
@@ -369,7 +504,7 @@ ov::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequence
         ngraph::pattern::Matcher matcher(unsqueeze);
 
         bool match = false;
-        auto func = ti->get_body();
+        auto func = ti->get_function();
         for (const auto& res : func->get_results()) {
             match = matcher.match((res->get_input_source_output(0)));
             if (match)
@@ -377,7 +512,8 @@ ov::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequence
         }
 
         // All nodes are in the TI body should be matched in pattern
-        if (!match || (matcher.get_matched_nodes().size() + func->get_results().size()) != func->get_ops().size())
+        if (!match || (matcher.get_matched_nodes().size() + func->get_results().size() + condition_nodes) !=
+                          func->get_ops().size())
             return false;
 
         const auto& pattern_map = matcher.get_pattern_value_map();
@@ -406,3 +542,155 @@ ov::pass::ConvertTensorIteratorToSequence::ConvertTensorIteratorToSequence() {
     add_matcher<ConvertTensorIteratorToRNNSequence>();
     add_matcher<ConvertTensorIteratorToGRUSequence>();
 }
+
+ov::pass::ConvertUnrolledCellsToSequence::ConvertUnrolledCellsToSequence() {
+    MATCHER_SCOPE(ConvertUnrolledCellsToSequence);
+    auto cell_m = pattern::wrap_type<ov::opset5::LSTMCell, ov::opset5::GRUCell, ov::opset5::RNNCell>();
+
+    matcher_pass_callback callback = [this](pattern::Matcher& m) {
+        const auto last_cell = std::dynamic_pointer_cast<ov::op::util::RNNCellBase>(m.get_match_root());
+        if (!last_cell || transformation_callback(last_cell))
+            return false;
+        const bool is_lstm = ngraph::is_type<ov::opset5::LSTMCell>(last_cell);
+
+        auto is_next_cell = [&](const std::shared_ptr<ov::op::util::RNNCellBase>& cell,
+                                const std::shared_ptr<ov::op::util::RNNCellBase>& next) {
+            return next && next->input_value(1) == cell->output(0) &&
+                   (!is_lstm || next->input_value(2) == cell->output(1)) && is_same_cell(cell, next);
+        };
+
+        // the chain is converted from its last cell
+        for (const auto& consumer : last_cell->output(0).get_target_inputs()) {
+            const auto next =
+                ngraph::as_type_ptr<ov::op::util::RNNCellBase>(consumer.get_node()->shared_from_this());
+            if (is_next_cell(last_cell, next))
+                return false;
+        }
+
+        std::vector<std::shared_ptr<ov::op::util::RNNCellBase>> chain{last_cell};
+        while (true) {
+            const auto prev = ngraph::as_type_ptr<ov::op::util::RNNCellBase>(chain.back()->get_input_node_shared_ptr(1));
+            if (!prev || !is_next_cell(prev, chain.back()))
+                break;
+            chain.push_back(prev);
+        }
+        std::reverse(chain.begin(), chain.end());
+        const size_t seq_len = chain.size();
+        if (seq_len < 2)
+            return false;
+
+        std::shared_ptr<ov::opset5::Split> split;
+        int64_t time_axis = 0;
+        std::vector<size_t> time_steps(seq_len);
+        for (size_t i = 0; i < seq_len; ++i) {
+            std::shared_ptr<ov::opset5::Split> cell_split;
+            int64_t cell_time_axis = 0;
+            if (!get_time_step(chain[i]->input_value(0), cell_split, cell_time_axis, time_steps[i]) ||
+                (split && (cell_split != split || cell_time_axis != time_axis)))
+                return false;
+            split = cell_split;
+            time_axis = cell_time_axis;
+        }
+        if (split->get_num_splits() != seq_len)
+            return false;
+
+        bool forward = true, reverse = true;
+        for (size_t i = 0; i < seq_len; ++i) {
+            forward = forward && time_steps[i] == i;
+            reverse = reverse && time_steps[i] == seq_len - 1 - i;
+        }
+        if (!forward && !reverse)
+            return false;
+
+        // the intermediate cell states aren't available from the sequence
+        if (is_lstm) {
+            for (size_t i = 0; i + 1 < seq_len; ++i) {
+                if (chain[i]->output(1).get_target_inputs().size() != 1)
+                    return false;
+            }
+        }
+
+        ngraph::NodeVector new_nodes;
+        ngraph::Output<ngraph::Node> X = split->input_value(0);
+        if (time_axis == 0) {
+            auto order = ov::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 0, 2});
+            X = std::make_shared<ov::opset5::Transpose>(X, order);
+            new_nodes.push_back(X.get_node_shared_ptr());
+        }
+
+        const auto& first_cell = chain.front();
+        auto axis_1 = ov::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto initial_hidden_state = std::make_shared<ov::opset5::Unsqueeze>(first_cell->input_value(1), axis_1);
+        new_nodes.push_back(initial_hidden_state);
+        std::shared_ptr<ngraph::Node> initial_cell_state;
+        if (is_lstm) {
+            initial_cell_state = std::make_shared<ov::opset5::Unsqueeze>(first_cell->input_value(2), axis_1);
+            new_nodes.push_back(initial_cell_state);
+        }
+
+        auto shape_of = std::make_shared<ov::opset5::ShapeOf>(X);
+        auto batch_dimension =
+            std::make_shared<ov::opset5::Gather>(shape_of,
+                                                 ov::opset5::Constant::create(ngraph::element::i64, {1}, {0}),
+                                                 ov::opset5::Constant::create(ngraph::element::i64, {}, {0}));
+        auto seq_lengths = std::make_shared<ov::opset5::Broadcast>(
+            ov::opset5::Constant::create(ngraph::element::i64, {1}, {seq_len}),
+            batch_dimension);
+        new_nodes.insert(new_nodes.end(), {shape_of, batch_dimension, seq_lengths});
+
+        const size_t w_idx = first_cell->get_input_size() - 3;
+        auto axis_0 = ov::opset5::Constant::create(ov::element::i64, ngraph::Shape{1}, {0});
+        auto W = ov::op::util::make_try_fold<ov::opset5::Unsqueeze>(first_cell->input_value(w_idx), axis_0);
+        auto R = ov::op::util::make_try_fold<ov::opset5::Unsqueeze>(first_cell->input_value(w_idx + 1), axis_0);
+        auto B = ov::op::util::make_try_fold<ov::opset5::Unsqueeze>(first_cell->input_value(w_idx + 2), axis_0);
+        new_nodes.insert(new_nodes.end(), {W, R, B});
+
+        const auto sequence = create_sequence(first_cell,
+                                              X,
+                                              initial_hidden_state,
+                                              initial_cell_state,
+                                              seq_lengths,
+                                              W,
+                                              R,
+                                              B,
+                                              forward ? ngraph::op::RecurrentSequenceDirection::FORWARD
+                                                      : ngraph::op::RecurrentSequenceDirection::REVERSE);
+        new_nodes.push_back(sequence);
+
+        // the hidden states of the intermediate cells consumed outside the chain are sliced from Y [B, 1, T, H]
+        std::shared_ptr<ov::opset5::Split> split_y;
+        const auto squeeze_axes = ov::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 2});
+        for (size_t i = 0; i + 1 < seq_len; ++i) {
+            if (chain[i]->output(0).get_target_inputs().size() == 1)
+                continue;
+            if (!split_y) {
+                split_y = std::make_shared<ov::opset5::Split>(
+                    sequence->output(0),
+                    ov::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {2}),
+                    seq_len);
+                new_nodes.push_back(split_y);
+            }
+            auto hidden_state = std::make_shared<ov::opset5::Squeeze>(split_y->output(time_steps[i]), squeeze_axes);
+            hidden_state->set_friendly_name(chain[i]->get_friendly_name());
+            new_nodes.push_back(hidden_state);
+            chain[i]->output(0).replace(hidden_state->output(0));
+        }
+
+        auto out_1 = std::make_shared<ov::opset5::Squeeze>(sequence->output(1), axis_1);
+        out_1->set_friendly_name(last_cell->get_friendly_name());
+        new_nodes.push_back(out_1);
+        last_cell->output(0).replace(out_1->output(0));
+        if (is_lstm) {
+            auto out_2 = std::make_shared<ov::opset5::Squeeze>(sequence->output(2), axis_1);
+            out_2->set_friendly_name(last_cell->get_friendly_name() + ".1");
+            new_nodes.push_back(out_2);
+            last_cell->output(1).replace(out_2->output(0));
+        }
+
+        copy_runtime_info(ngraph::NodeVector(chain.begin(), chain.end()), new_nodes);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(cell_m, matcher_name);
+    register_matcher(m, callback);
+}
@@ -805,3 +805,290 @@ TEST(TransformationTests, ConvertTensorIteratorToGRUSequenceDynamicSqueezeCase)
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, ConvertLoopToLSTMSequence) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_body = [](int64_t trip_count) {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 2, 16});
+        auto Y = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto Z = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto Yi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto Zi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        // Body
+        auto squeeze_axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto squeeze = std::make_shared<opset5::Squeeze>(Xi, squeeze_axis);
+
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 16}, {0});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512}, {0});
+
+        auto lstm_cell = std::make_shared<opset5::LSTMCell>(squeeze, Yi, Zi, W, R, B, 128);
+        auto lstm_res_1 = std::make_shared<opset5::Result>(lstm_cell->output(0));
+        auto lstm_res_2 = std::make_shared<opset5::Result>(lstm_cell->output(1));
+        auto unsqueeze_axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto unsqueeze = std::make_shared<opset5::Unsqueeze>(lstm_cell->output(0), unsqueeze_axis);
+        auto lstm_res1_unsqueeze = std::make_shared<opset5::Result>(unsqueeze);
+        auto condition = std::make_shared<opset5::Result>(
+            ngraph::opset5::Constant::create(ngraph::element::boolean, ngraph::Shape{1}, {true}));
+        auto body = std::make_shared<Function>(OutputVector{lstm_res_1, lstm_res1_unsqueeze, lstm_res_2, condition},
+                                               ParameterVector{Xi, Yi, Zi});
+
+        auto loop = std::make_shared<opset5::Loop>(
+            ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {trip_count}),
+            ngraph::opset5::Constant::create(ngraph::element::boolean, ngraph::Shape{}, {true}));
+        loop->set_function(body);
+        loop->set_special_body_ports({-1, 3});
+
+        loop->set_sliced_input(Xi, X, 0, 1, 1, -1, 1);
+        loop->set_merged_input(Yi, Y, lstm_res_1);
+        loop->set_merged_input(Zi, Z, lstm_res_2);
+
+        auto out0 = loop->get_concatenated_slices(lstm_res1_unsqueeze, 0, 1, 1, -1, 1);
+        auto out1 = loop->get_iter_value(lstm_res_1, -1);
+        auto out2 = loop->get_iter_value(lstm_res_2, -1);
+
+        auto res_ti_0 = std::make_shared<opset5::Result>(out0);
+        auto res_ti_1 = std::make_shared<opset5::Result>(out1);
+        auto res_ti_2 = std::make_shared<opset5::Result>(out2);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{res_ti_0, res_ti_1, res_ti_2},
+                                                  ngraph::ParameterVector{X, Y, Z});
+    };
+
+    {
+        f = create_body(2);
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ov::pass::ConvertTensorIteratorToLSTMSequence>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 2, 16});
+        auto Y = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto Z = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 512, 16}, {0});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 512, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 512}, {0});
+
+        auto axis_1 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto in_1 = std::make_shared<ngraph::opset5::Unsqueeze>(Y, axis_1);
+        auto in_2 = std::make_shared<ngraph::opset5::Unsqueeze>(Z, axis_1);
+
+        auto seq_lengths = create_seq_len(X);
+        auto lstm_seq = std::make_shared<opset5::LSTMSequence>(X,
+                                                               in_1,
+                                                               in_2,
+                                                               seq_lengths,
+                                                               W,
+                                                               R,
+                                                               B,
+                                                               128,
+                                                               op::RecurrentSequenceDirection::FORWARD);
+        auto axis_out = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto out_0 = std::make_shared<ngraph::opset5::Squeeze>(lstm_seq->output(0), axis_out);
+        auto out_1 = std::make_shared<ngraph::opset5::Squeeze>(lstm_seq->output(1), axis_out);
+        auto out_2 = std::make_shared<ngraph::opset5::Squeeze>(lstm_seq->output(2), axis_out);
+
+        auto res_ti_0 = std::make_shared<opset5::Result>(out_0);
+        auto res_ti_1 = std::make_shared<opset5::Result>(out_1);
+        auto res_ti_2 = std::make_shared<opset5::Result>(out_2);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_ti_0, res_ti_1, res_ti_2},
+                                                   ngraph::ParameterVector{X, Y, Z});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    // the Loop which runs less iterations than the input has slices isn't a sequence
+    {
+        auto f_partial = create_body(1);
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::ConvertTensorIteratorToLSTMSequence>();
+        m.run_passes(f_partial);
+        ASSERT_EQ(count_ops_of_type<opset5::Loop>(f_partial), 1);
+        ASSERT_EQ(count_ops_of_type<opset5::LSTMSequence>(f_partial), 0);
+    }
+}
+
+TEST(TransformationTests, ConvertUnrolledLSTMCellsToSequence) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 3, 16});
+        auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto C = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 16}, {0});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512}, {0});
+
+        auto split = std::make_shared<opset5::Split>(X, opset5::Constant::create(element::i64, Shape{}, {1}), 3);
+        auto axis = opset5::Constant::create(element::i64, Shape{1}, {1});
+        std::shared_ptr<Node> cell;
+        Output<Node> h = H, c = C;
+        NodeVector cells;
+        for (size_t t = 0; t < 3; t++) {
+            auto squeeze = std::make_shared<opset5::Squeeze>(split->output(t), axis);
+            cell = std::make_shared<opset5::LSTMCell>(squeeze, h, c, W, R, B, 128);
+            h = cell->output(0);
+            c = cell->output(1);
+            cells.push_back(cell);
+        }
+
+        // the hidden state of the first time step is consumed outside the chain
+        auto res_0 = std::make_shared<opset5::Result>(cells[0]->output(0));
+        auto res_1 = std::make_shared<opset5::Result>(cell->output(0));
+        auto res_2 = std::make_shared<opset5::Result>(cell->output(1));
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_0, res_1, res_2}, ngraph::ParameterVector{X, H, C});
+
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ov::pass::ConvertUnrolledCellsToSequence>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 3, 16});
+        auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto C = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto axis_1 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto in_1 = std::make_shared<ngraph::opset5::Unsqueeze>(H, axis_1);
+        auto in_2 = std::make_shared<ngraph::opset5::Unsqueeze>(C, axis_1);
+
+        auto shape_of = std::make_shared<opset5::ShapeOf>(X);
+        auto batch_dimension =
+            std::make_shared<ngraph::opset5::Gather>(shape_of,
+                                                     ngraph::opset5::Constant::create(ngraph::element::i64, {1}, {0}),
+                                                     ngraph::opset5::Constant::create(ngraph::element::i64, {}, {0}));
+        auto seq_lengths =
+            std::make_shared<opset5::Broadcast>(ngraph::opset5::Constant::create(ngraph::element::i64, {1}, {3}),
+                                                batch_dimension);
+
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 512, 16}, {0});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 512, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 512}, {0});
+
+        auto lstm_seq = std::make_shared<opset5::LSTMSequence>(X,
+                                                               in_1,
+                                                               in_2,
+                                                               seq_lengths,
+                                                               W,
+                                                               R,
+                                                               B,
+                                                               128,
+                                                               op::RecurrentSequenceDirection::FORWARD);
+        auto split_y =
+            std::make_shared<opset5::Split>(lstm_seq->output(0), opset5::Constant::create(element::i64, Shape{}, {2}), 3);
+        auto out_0 = std::make_shared<ngraph::opset5::Squeeze>(split_y->output(0),
+                                                               opset5::Constant::create(element::i64, Shape{2}, {1, 2}));
+        auto out_1 = std::make_shared<ngraph::opset5::Squeeze>(lstm_seq->output(1), axis_1);
+        auto out_2 = std::make_shared<ngraph::opset5::Squeeze>(lstm_seq->output(2), axis_1);
+
+        auto res_0 = std::make_shared<opset5::Result>(out_0);
+        auto res_1 = std::make_shared<opset5::Result>(out_1);
+        auto res_2 = std::make_shared<opset5::Result>(out_2);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_0, res_1, res_2}, ngraph::ParameterVector{X, H, C});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertUnrolledGRUCellsToReverseSequence) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{3, 1, 16});
+        auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384, 16}, {0});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384}, {0});
+
+        // the time axis is the outermost one and the time steps are processed from the last one
+        auto split = std::make_shared<opset5::Split>(X, opset5::Constant::create(element::i64, Shape{}, {0}), 3);
+        auto shape = opset5::Constant::create(element::i64, Shape{2}, {1, 16});
+        Output<Node> h = H;
+        for (size_t t = 0; t < 3; t++) {
+            auto reshape = std::make_shared<opset5::Reshape>(split->output(2 - t), shape, false);
+            h = std::make_shared<opset5::GRUCell>(reshape, h, W, R, B, 128)->output(0);
+        }
+
+        auto res = std::make_shared<opset5::Result>(h);
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{res}, ngraph::ParameterVector{X, H});
+
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ov::pass::ConvertUnrolledCellsToSequence>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{3, 1, 16});
+        auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto transpose =
+            std::make_shared<opset5::Transpose>(X, opset5::Constant::create(element::i64, Shape{3}, {1, 0, 2}));
+        auto axis_1 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto in_1 = std::make_shared<ngraph::opset5::Unsqueeze>(H, axis_1);
+
+        auto shape_of = std::make_shared<opset5::ShapeOf>(transpose);
+        auto batch_dimension =
+            std::make_shared<ngraph::opset5::Gather>(shape_of,
+                                                     ngraph::opset5::Constant::create(ngraph::element::i64, {1}, {0}),
+                                                     ngraph::opset5::Constant::create(ngraph::element::i64, {}, {0}));
+        auto seq_lengths =
+            std::make_shared<opset5::Broadcast>(ngraph::opset5::Constant::create(ngraph::element::i64, {1}, {3}),
+                                                batch_dimension);
+
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384, 16}, {0});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384}, {0});
+
+        auto gru_seq = std::make_shared<opset5::GRUSequence>(transpose,
+                                                             in_1,
+                                                             seq_lengths,
+                                                             W,
+                                                             R,
+                                                             B,
+                                                             128,
+                                                             op::RecurrentSequenceDirection::REVERSE);
+        auto out = std::make_shared<ngraph::opset5::Squeeze>(gru_seq->output(1), axis_1);
+        auto res = std::make_shared<opset5::Result>(out);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{res}, ngraph::ParameterVector{X, H});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertUnrolledCellsToSequenceDifferentWeights) {
+    auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 2, 16});
+    auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+    auto split = std::make_shared<opset5::Split>(X, opset5::Constant::create(element::i64, Shape{}, {1}), 2);
+    auto axis = opset5::Constant::create(element::i64, Shape{1}, {1});
+    Output<Node> h = H;
+    for (size_t t = 0; t < 2; t++) {
+        // each time step has its own weights, so the cells aren't the time steps of one sequence
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{128, 16}, {static_cast<float>(t)});
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{128, 128}, {0});
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{128}, {0});
+        auto squeeze = std::make_shared<opset5::Squeeze>(split->output(t), axis);
+        h = std::make_shared<opset5::RNNCell>(squeeze, h, W, R, B, 128)->output(0);
+    }
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{std::make_shared<opset5::Result>(h)},
+                                                ngraph::ParameterVector{X, H});
+
+    ngraph::pass::Manager m;
+    m.register_pass<ov::pass::ConvertUnrolledCellsToSequence>();
+    m.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<opset5::RNNCell>(f), 2);
+    ASSERT_EQ(count_ops_of_type<opset5::RNNSequence>(f), 0);
+}
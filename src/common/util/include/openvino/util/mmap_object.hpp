@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief Read-only memory mapped to a file, the mapping is released with the object
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file to memory (read-only)
+ * @param path Path to the file
+ * @return The mapped memory, throws std::runtime_error if the file cannot be mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
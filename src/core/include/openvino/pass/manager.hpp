@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -14,6 +18,40 @@
 
 namespace ov {
 namespace pass {
+/// \brief Statistics of one MatcherPass collected while a transformation was running
+struct MatcherProfile {
+    std::string name;
+    /// \brief Number of the nodes the matcher was applied to
+    size_t calls = 0;
+    /// \brief Number of successful matcher callbacks
+    size_t rewrites = 0;
+    std::chrono::nanoseconds duration{0};
+};
+
+/// \brief Profiling record of one transformation run by pass::Manager
+struct PassProfile {
+    std::string name;
+    /// \brief Nesting level, transformations run by the managers inside other transformations have depth > 0
+    size_t depth = 0;
+    /// \brief Start time relative to the start of Manager::run_passes
+    std::chrono::nanoseconds start{0};
+    std::chrono::nanoseconds duration{0};
+    /// \brief Value returned by the transformation
+    bool applied = false;
+    /// \brief Number of successful matcher callbacks including the nested transformations
+    size_t rewrites = 0;
+    /// \brief Difference of the number of model nodes after and before the transformation
+    int64_t node_count_delta = 0;
+    /// \brief Difference of the process resident memory after and before the transformation in bytes
+    int64_t memory_delta = 0;
+    /// \brief Peak process resident memory during the transformation in bytes, 0 if it isn't available
+    /// The resident memory is sampled at the start and the end of the transformation and of the nested ones,
+    /// so the short allocation spikes between the samples aren't reported
+    size_t peak_memory = 0;
+    /// \brief Matchers applied directly by this transformation
+    std::vector<MatcherProfile> matchers;
+};
+
 /**
  * @brief Manager class allows to manage transformation passes
  * @ingroup ov_pass_cpp_api
@@ -76,6 +114,27 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable profiling of the transformations
+    /// When profiling is enabled, run_passes collects PassProfile record for each transformation, including
+    /// the transformations run by nested managers. Profiling adds the overhead of counting the model nodes
+    /// and reading the process memory usage for each transformation.
+    /// The OV_PASS_PROFILE_DIR environment variable enables profiling for all the managers and saves the profile
+    /// of each outermost run_passes call to <dir>/pass_profile_<index>.json.
+    /// \param new_state Value "true" enables profiling; "false", otherwise
+    void set_profiling(bool new_state) {
+        m_profiling = new_state;
+    }
+
+    /// \return Profiling records of the last run_passes call in the order the transformations were started
+    const std::vector<PassProfile>& get_profile() const {
+        return m_profile;
+    }
+
+    /// \brief Write profiling records of the last run_passes call in Chrome trace event format
+    /// The output can be opened in chrome://tracing or Perfetto UI
+    /// \param stream Output stream
+    void export_profile(std::ostream& stream) const;
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -99,6 +158,8 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_profiling = false;
+    std::vector<PassProfile> m_profile;
 };
 }  // namespace pass
 }  // namespace ov
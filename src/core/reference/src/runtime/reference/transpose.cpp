@@ -4,27 +4,91 @@
 
 #include "ngraph/runtime/reference/transpose.hpp"
 
-#include <cfenv>
-#include <cmath>
+#include <cstring>
 #include <numeric>
 #include <vector>
 
-#include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/shape.hpp"
+#include "openvino/core/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+template <size_t block_size>
+void copy_blocks(const char* in, char* out, size_t count, size_t in_stride) {
+    for (size_t i = 0; i < count; ++i) {
+        std::memcpy(out + i * block_size, in + i * in_stride, block_size);
+    }
+}
+
+void copy_blocks(const char* in, char* out, size_t count, size_t in_stride, size_t block_size) {
+    switch (block_size) {
+    case 1:
+        copy_blocks<1>(in, out, count, in_stride);
+        break;
+    case 2:
+        copy_blocks<2>(in, out, count, in_stride);
+        break;
+    case 4:
+        copy_blocks<4>(in, out, count, in_stride);
+        break;
+    case 8:
+        copy_blocks<8>(in, out, count, in_stride);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(out + i * block_size, in + i * in_stride, block_size);
+        }
+        break;
+    }
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
                size_t element_size,
                const int64_t* axes_order,
                Shape out_shape) {
-    // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
     // Negative axes are not supported, it is validated by transpose evaluate method
-    std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
-    runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+    const size_t count = shape_size(data_shape);
+
+    // Trailing axes which keep their positions are copied as one block
+    size_t rank = data_shape.size();
+    size_t block_size = element_size;
+    while (rank > 0 && static_cast<size_t>(axes_order[rank - 1]) == rank - 1) {
+        block_size *= data_shape[rank - 1];
+        --rank;
+    }
+    if (rank == 0 || count == 0) {
+        std::memcpy(out, data, count * element_size);
+        return;
+    }
+
+    std::vector<size_t> data_strides(rank);
+    for (size_t i = rank, stride = block_size; i-- > 0;) {
+        data_strides[i] = stride;
+        stride *= data_shape[i];
+    }
+    // Output dimensions with the data strides of the corresponding input axes
+    std::vector<size_t> dims(rank), strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        dims[i] = data_shape[axes_order[i]];
+        strides[i] = data_strides[axes_order[i]];
+    }
+
+    // Each thread writes its own rows of the output, the input row is read with the stride of the last output axis
+    const size_t row_size = dims[rank - 1];
+    const size_t rows = count * element_size / block_size / row_size;
+    ov::parallel_for(rows, [&](size_t row) {
+        size_t data_offset = 0;
+        for (size_t i = rank - 1, idx = row; i-- > 0;) {
+            data_offset += (idx % dims[i]) * strides[i];
+            idx /= dims[i];
+        }
+        copy_blocks(data + data_offset, out + row * row_size * block_size, row_size, strides[rank - 1], block_size);
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -4,6 +4,7 @@
 
 #include "ngraph/op/convert.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <ngraph/validation_util.hpp>
 
@@ -11,6 +12,7 @@
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/runtime/reference/convert.hpp"
+#include "openvino/core/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -41,25 +43,43 @@ shared_ptr<Node> op::Convert::clone_with_new_inputs(const OutputVector& new_args
 
 namespace convert {
 namespace {
+// Elements are converted by blocks in parallel. The block size is a multiple of 8, so the blocks of the packed
+// low precision types start at byte boundaries and don't share bytes.
+constexpr size_t block_size = 32768;
+
+size_t byte_offset(element::Type_t type, size_t idx) {
+    if (type == element::u1)
+        return idx / 8;
+    if (type == element::u4 || type == element::i4)
+        return idx / 2;
+    return idx * element::Type(type).size();
+}
+
 template <element::Type_t INPUT_ET, element::Type_t OUTPUT_ET>
 bool evaluate(const HostTensorPtr& arg, const HostTensorPtr& out) {
+    using input_t = typename element_type_traits<INPUT_ET>::value_type;
+    using output_t = typename element_type_traits<OUTPUT_ET>::value_type;
     out->set_shape(arg->get_shape());
     size_t element_count = shape_size(out->get_shape());
 
     if ((INPUT_ET != arg->get_element_type()) || OUTPUT_ET != out->get_element_type()) {
         return false;
     }
-    if (((INPUT_ET == element::u1) || (OUTPUT_ET == element::u1)) ||
-        ((INPUT_ET == element::u4) || (OUTPUT_ET == element::u4)) ||
-        ((INPUT_ET == element::i4) || (OUTPUT_ET == element::i4))) {
-        runtime::reference::detail::lp_convert(arg->get_data_ptr<INPUT_ET>(),
-                                               out->get_data_ptr<OUTPUT_ET>(),
-                                               element_count,
-                                               INPUT_ET,
-                                               OUTPUT_ET);
-    } else {
-        runtime::reference::convert(arg->get_data_ptr<INPUT_ET>(), out->get_data_ptr<OUTPUT_ET>(), element_count);
-    }
+    const auto arg_data = static_cast<const char*>(arg->get_data_ptr());
+    const auto out_data = static_cast<char*>(out->get_data_ptr());
+    ov::parallel_for((element_count + block_size - 1) / block_size, [&](size_t block) {
+        const size_t start = block * block_size;
+        const size_t count = std::min(block_size, element_count - start);
+        const auto src = reinterpret_cast<const input_t*>(arg_data + byte_offset(INPUT_ET, start));
+        const auto dst = reinterpret_cast<output_t*>(out_data + byte_offset(OUTPUT_ET, start));
+        if (((INPUT_ET == element::u1) || (OUTPUT_ET == element::u1)) ||
+            ((INPUT_ET == element::u4) || (OUTPUT_ET == element::u4)) ||
+            ((INPUT_ET == element::i4) || (OUTPUT_ET == element::i4))) {
+            runtime::reference::detail::lp_convert(src, dst, count, INPUT_ET, OUTPUT_ET);
+        } else {
+            runtime::reference::convert(src, dst, count);
+        }
+    });
     return true;
 }
 
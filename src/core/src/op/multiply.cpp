@@ -4,26 +4,66 @@
 
 #include "ngraph/op/multiply.hpp"
 
+#include <algorithm>
+
 #include "itt.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/reference/multiply.hpp"
+#include "openvino/core/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 namespace multiplyop {
 namespace {
+constexpr size_t block_size = 16384;
+
 template <element::Type_t ET>
 bool evaluate(const HostTensorPtr& arg0,
               const HostTensorPtr& arg1,
               const HostTensorPtr& out,
               const op::AutoBroadcastSpec& broadcast_spec) {
-    runtime::reference::multiply(arg0->get_data_ptr<ET>(),
-                                 arg1->get_data_ptr<ET>(),
-                                 out->get_data_ptr<ET>(),
-                                 arg0->get_shape(),
-                                 arg1->get_shape(),
-                                 broadcast_spec);
+    const auto arg0_data = arg0->get_data_ptr<ET>();
+    const auto arg1_data = arg1->get_data_ptr<ET>();
+    const auto out_data = out->get_data_ptr<ET>();
+    const auto& arg0_shape = arg0->get_shape();
+    const auto& arg1_shape = arg1->get_shape();
+
+    // Elements of the tensors with the same shape are multiplied by blocks in parallel
+    if (arg0_shape == arg1_shape) {
+        const size_t count = shape_size(arg0_shape);
+        ov::parallel_for((count + block_size - 1) / block_size, [&](size_t block) {
+            const size_t start = block * block_size;
+            runtime::reference::multiply(arg0_data + start,
+                                         arg1_data + start,
+                                         out_data + start,
+                                         std::min(block_size, count - start));
+        });
+        return true;
+    }
+
+    // Numpy broadcasting of the tensors with the same rank (e.g. per channel scales) is split by the outer axis
+    const size_t rank = arg0_shape.size();
+    if (broadcast_spec.m_type == op::AutoBroadcastType::NUMPY && rank > 1 && rank == arg1_shape.size() &&
+        std::max(arg0_shape[0], arg1_shape[0]) > 1) {
+        const size_t outer_size = std::max(arg0_shape[0], arg1_shape[0]);
+        Shape arg0_inner_shape(arg0_shape), arg1_inner_shape(arg1_shape);
+        arg0_inner_shape[0] = arg1_inner_shape[0] = 1;
+        const size_t arg0_stride = arg0_shape[0] == 1 ? 0 : shape_size(arg0_inner_shape);
+        const size_t arg1_stride = arg1_shape[0] == 1 ? 0 : shape_size(arg1_inner_shape);
+        const size_t out_stride = shape_size(out->get_shape()) / outer_size;
+        ov::parallel_for(outer_size, [&](size_t i) {
+            runtime::reference::multiply(arg0_data + i * arg0_stride,
+                                         arg1_data + i * arg1_stride,
+                                         out_data + i * out_stride,
+                                         arg0_inner_shape,
+                                         arg1_inner_shape,
+                                         broadcast_spec);
+        });
+        return true;
+    }
+
+    runtime::reference::multiply(arg0_data, arg1_data, out_data, arg0_shape, arg1_shape, broadcast_spec);
     return true;
 }
 
@@ -4,6 +4,8 @@
 
 #include "ngraph/op/util/gather_base.hpp"
 
+#include <numeric>
+
 #include "bound_evaluate.hpp"
 #include "gather_shape_inference.hpp"
 #include "itt.hpp"
@@ -11,8 +13,8 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/squeeze.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
-#include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/shape.hpp"
+#include "openvino/core/parallel.hpp"
 
 using namespace std;
 
@@ -62,6 +64,41 @@ void ov::op::util::GatherBase::set_batch_dims(int64_t batch_dims) {
 
 namespace gather {
 namespace {
+// The same as ngraph::runtime::reference::gather, but the rows of the output are copied in parallel
+template <typename T, typename U>
+void parallel_gather(const T* const data,
+                     const U* const indices,
+                     T* out,
+                     const ov::Shape& data_shape,
+                     const ov::Shape& indices_shape,
+                     size_t axis,
+                     size_t batch_dims) {
+    const auto size = [](const ov::Shape& shape, size_t begin, size_t end) {
+        return std::accumulate(shape.begin() + begin, shape.begin() + end, size_t(1), std::multiplies<size_t>());
+    };
+    // flattened shapes
+    const size_t batch_size = size(data_shape, 0, batch_dims);
+    const size_t outer_size = size(data_shape, batch_dims, axis);
+    const size_t indices_size = size(indices_shape, batch_dims, indices_shape.size());
+    const size_t inner_size = size(data_shape, axis + 1, data_shape.size());
+    const size_t axis_size = data_shape[axis];
+
+    ov::parallel_for2d(batch_size * outer_size, indices_size, [&](size_t batch_outer, size_t i) {
+        const size_t batch = batch_outer / outer_size;
+        auto idx = static_cast<int64_t>(indices[i + indices_size * batch]);
+        if (idx < 0)
+            idx += static_cast<int64_t>(axis_size);
+        const auto out_ptr = out + (batch_outer * indices_size + i) * inner_size;
+        // for out of bound indices is filled with zeros
+        if (idx >= static_cast<int64_t>(axis_size) || idx < 0) {
+            std::fill(out_ptr, out_ptr + inner_size, T{0});
+            return;
+        }
+        const auto src_begin = data + (batch_outer * axis_size + static_cast<size_t>(idx)) * inner_size;
+        std::copy(src_begin, src_begin + inner_size, out_ptr);
+    });
+}
+
 template <ov::element::Type_t ET>
 bool evaluate(const ngraph::HostTensorPtr& arg0,
               const ngraph::HostTensorPtr& arg1,
@@ -86,23 +123,21 @@ bool evaluate(const ngraph::HostTensorPtr& arg0,
     out->set_shape(out_shape);
 
     if (arg1->get_element_type() == ov::element::i64) {
-        ngraph::runtime::reference::gather<T, int64_t>(arg0->get_data_ptr<ET>(),
-                                                       arg1->get_data_ptr<int64_t>(),
-                                                       out->get_data_ptr<ET>(),
-                                                       arg0->get_shape(),
-                                                       arg1->get_shape(),
-                                                       out->get_shape(),
-                                                       axis,
-                                                       batch_dims);
+        parallel_gather<T, int64_t>(arg0->get_data_ptr<ET>(),
+                                  arg1->get_data_ptr<int64_t>(),
+                                  out->get_data_ptr<ET>(),
+                                  arg0->get_shape(),
+                                  arg1->get_shape(),
+                                  axis,
+                                  batch_dims);
     } else if (arg1->get_element_type() == ov::element::i32) {
-        ngraph::runtime::reference::gather<T, int32_t>(arg0->get_data_ptr<ET>(),
-                                                       arg1->get_data_ptr<int32_t>(),
-                                                       out->get_data_ptr<ET>(),
-                                                       arg0->get_shape(),
-                                                       arg1->get_shape(),
-                                                       out->get_shape(),
-                                                       axis,
-                                                       batch_dims);
+        parallel_gather<T, int32_t>(arg0->get_data_ptr<ET>(),
+                                  arg1->get_data_ptr<int32_t>(),
+                                  out->get_data_ptr<ET>(),
+                                  arg0->get_shape(),
+                                  arg1->get_shape(),
+                                  axis,
+                                  batch_dims);
     } else {
         OPENVINO_THROW("Unexpected type ", arg1->get_element_type().c_type_string(), " for Gather evaluate method.");
     }
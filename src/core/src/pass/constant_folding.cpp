@@ -4,11 +4,23 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <exception>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_map>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
+#include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
@@ -51,51 +63,139 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Check if \ref ov::Node can be folded in parallel with other nodes.
+ *
+ * Only the operations with the audited constant_fold are folded in parallel: it reads the constant inputs, creates
+ * new constants and doesn't change any state shared with other nodes. The rest, including operations with subgraphs,
+ * ConvertLike (it connects a temporary Convert to its input) and the operations of extensions, are folded
+ * sequentially.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if node can be folded in parallel otherwise false.
+ */
+const auto is_parallel_foldable = [](const std::shared_ptr<ov::Node>& node) {
+    const auto thread_safe = ov::is_type<ov::op::v0::Convert>(node) || ov::is_type<ov::op::v1::Multiply>(node) ||
+                             ov::is_type<ov::op::v1::Add>(node) || ov::is_type<ov::op::v1::Subtract>(node) ||
+                             ov::is_type<ov::op::v1::Transpose>(node) || ov::is_type<ov::op::v1::Reshape>(node) ||
+                             ov::is_type<ov::op::v0::Squeeze>(node) || ov::is_type<ov::op::v0::Unsqueeze>(node) ||
+                             ov::is_type<ov::op::util::GatherBase>(node);
+    if (!thread_safe)
+        return false;
+    const auto& input_values = node->input_values();
+    return std::all_of(input_values.cbegin(), input_values.cend(), [](const ov::Output<ov::Node>& input) {
+        return ov::is_type<ov::op::v0::Constant>(input.get_node());
+    });
+};
+
+/**
+ * \brief Split nodes by levels of the graph.
+ *
+ * Inputs and control dependencies of the nodes of one level are produced by the previous levels only.
+ *
+ * \param ordered_ops  Nodes in topological order.
+ *
+ * \return Vector of levels, nodes of each level are in topological order.
+ */
+const auto split_by_levels = [](std::vector<std::shared_ptr<ov::Node>>&& ordered_ops) {
+    std::vector<std::vector<std::shared_ptr<ov::Node>>> levels;
+    std::unordered_map<const ov::Node*, size_t> node_levels;
+    for (auto& node : ordered_ops) {
+        size_t level = 0;
+        for (const auto& input : node->input_values()) {
+            level = std::max(level, node_levels.at(input.get_node()) + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            level = std::max(level, node_levels.at(dependency.get()) + 1);
+        }
+        node_levels[node.get()] = level;
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(std::move(node));
+    }
+    return levels;
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    // Nodes of one level don't depend on each other, so they are folded in parallel and replaced sequentially.
+    // Each level is released after folding, so the folded nodes and the intermediate constants are freed as soon as
+    // all their consumers are folded.
+    auto levels = split_by_levels(model->get_ordered_ops());
+    for (auto& level : levels) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level) {
+                node->validate_and_infer_types();
+            }
         }
 
-        OutputVector replacements(node->get_output_size());
-
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> folded(level.size(), false);
+        std::vector<std::exception_ptr> errors(level.size());
+        ov::parallel_for(level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            if (!is_parallel_foldable(node))
+                return;
+            try {
+                replacements[i].resize(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
 
-                    rewritten = true;
-                }
+        for (size_t node_idx = 0; node_idx < level.size(); ++node_idx) {
+            const auto& node = level[node_idx];
+            if (errors[node_idx]) {
+                std::rethrow_exception(errors[node_idx]);
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+            if (!is_parallel_foldable(node)) {
+                replacements[node_idx].resize(node->get_output_size());
+                folded[node_idx] = node->constant_fold(replacements[node_idx], node->input_values());
+            }
+
+            if (folded[node_idx]) {
+                const auto& node_replacements = replacements[node_idx];
+                OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                                "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                                node);
+                OPENVINO_ASSERT(node_replacements.size() == node->get_output_size(),
+                                "constant_fold_default returned incorrect number of replacements for ",
+                                node);
+
+                for (size_t i = 0; i < node_replacements.size(); ++i) {
+                    auto node_output = node->output(i);
+                    auto replacement = node_replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                        replacement.get_node()->set_friendly_name(
+                            friendly_name_from(*node, node_replacements.size(), i));
+
+                        node_output.replace(replacement);
+                        // Copy runtime info from source nodes
+                        // when it was not propogated during pre-calculation
+                        copy_runtime_info_from_input_values(node);
+                        // Propagate runtime info attributes to replacement
+                        copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+                        rewritten = true;
+                    }
+                }
+            } else {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+                    }
                 }
             }
         }
+        level.clear();
     }
 
     return rewritten;
@@ -5,6 +5,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -17,6 +18,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "pass_profiler.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -295,7 +297,13 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
 bool ov::pass::MatcherPass::apply(std::shared_ptr<ov::Node> node) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, pass::perf_counters_graph_rewrite()[get_type_info()]);
     clear_new_nodes();
-    if (m_handler)
-        return m_handler(node);
-    return false;
+    if (!m_handler)
+        return false;
+    if (auto profiler = PassProfiler::get_active()) {
+        const auto start = std::chrono::steady_clock::now();
+        const bool status = m_handler(node);
+        profiler->add_matcher_run(get_name(), std::chrono::steady_clock::now() - start, status);
+        return status;
+    }
+    return m_handler(node);
 }
@@ -5,6 +5,8 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -21,6 +23,7 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
 #include "openvino/util/env_util.hpp"
+#include "pass_profiler.hpp"
 #include "perf_counters.hpp"
 
 using namespace std;
@@ -45,6 +48,18 @@ bool getenv_visualize_tracing() {
     return ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING") ||
            ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING");
 }
+
+// Writes the profile of the outermost profiled run_passes call to <dir>/pass_profile_<index>.json
+void write_profile_to_dir(const std::string& dir, const std::vector<ov::pass::PassProfile>& profile) {
+    static std::atomic<size_t> index{0};
+    const auto file_name = dir + "/pass_profile_" + std::to_string(index++) + ".json";
+    std::ofstream file(file_name);
+    if (!file) {
+        NGRAPH_WARN << "Can't write the transformations profile to " << file_name;
+        return;
+    }
+    ov::pass::write_chrome_trace(profile, file);
+}
 }  // namespace
 
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()), m_visualize(getenv_visualize_tracing()) {}
@@ -59,6 +74,10 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::export_profile(std::ostream& stream) const {
+    write_chrome_trace(m_profile, stream);
+}
+
 bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::Manager::run_passes");
@@ -66,6 +85,18 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     static bool profile_enabled =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
 
+    // The managers created internally (e.g. by the plugins' transformation pipelines) are profiled
+    // without code changes when the directory for the profiles is set
+    static const std::string profile_dir = ov::util::getenv_string("OV_PASS_PROFILE_DIR");
+
+    // The nested managers add their records to the profiler of the outermost profiled manager
+    std::unique_ptr<PassProfiler> own_profiler;
+    if ((m_profiling || !profile_dir.empty()) && !PassProfiler::get_active()) {
+        m_profile.clear();
+        own_profiler.reset(new PassProfiler(m_profile));
+    }
+    const auto profiler = PassProfiler::get_active();
+
     size_t index = 0;
     ngraph::stopwatch pass_timer;
     ngraph::stopwatch overall_timer;
@@ -80,6 +111,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, pass::perf_counters()[pass->get_type_info()]);
+        PassProfiler::Scope profile_scope(profiler, pass->get_name(), func);
 
         pass_timer.start();
 
@@ -94,6 +126,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
             pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            profile_scope.applied = pass_applied;
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -105,11 +138,12 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (needs_validate) {
-                    function_pass->run_on_model(func);
+                    profile_scope.applied = function_pass->run_on_model(func);
                     needs_validate = false;
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
+                profile_scope.applied = pass_applied;
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
@@ -117,9 +151,12 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                              << "model is dynamic. Skipping this transformation";
                 continue;
             }
+            bool nodes_applied = false;
             for (const shared_ptr<Node>& n : func->get_ops()) {
-                pass_applied |= node_pass->run_on_node(n);
+                nodes_applied |= node_pass->run_on_node(n);
             }
+            pass_applied |= nodes_applied;
+            profile_scope.applied = nodes_applied;
         }
 
         if (m_visualize) {
@@ -146,6 +183,9 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    if (own_profiler && !profile_dir.empty()) {
+        write_profile_to_dir(profile_dir, m_profile);
+    }
     NGRAPH_SUPPRESS_DEPRECATED_END
 
     return function_changed;
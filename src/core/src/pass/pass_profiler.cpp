@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pass_profiler.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace ov {
+namespace pass {
+namespace {
+thread_local PassProfiler* active_profiler = nullptr;
+
+// Returns the process resident memory in bytes or 0 if it isn't available.
+// VmRSS is sampled rather than VmHWM, since resetting the process-wide peak would affect other readers of it.
+size_t get_memory_usage() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0)
+            return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+    }
+#endif
+    return 0;
+}
+
+size_t get_node_count(const std::shared_ptr<Model>& model) {
+    return model ? model->get_ops().size() : 0;
+}
+
+int64_t to_microseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+std::string escape_json(const std::string& str) {
+    std::ostringstream escaped;
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            escaped << "\\\"";
+            break;
+        case '\\':
+            escaped << "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                        << std::dec;
+            } else {
+                escaped << c;
+            }
+        }
+    }
+    return escaped.str();
+}
+}  // namespace
+
+PassProfiler::PassProfiler(std::vector<PassProfile>& records)
+    : m_records(records),
+      m_start(std::chrono::steady_clock::now()),
+      m_previous(active_profiler) {
+    active_profiler = this;
+}
+
+PassProfiler::~PassProfiler() {
+    active_profiler = m_previous;
+}
+
+PassProfiler* PassProfiler::get_active() {
+    return active_profiler;
+}
+
+void PassProfiler::begin_pass(const std::string& name, const std::shared_ptr<Model>& model) {
+    PassProfile record;
+    record.name = name;
+    record.depth = m_running.size();
+    const auto memory = get_memory_usage();
+    if (!m_running.empty()) {
+        auto& parent = m_running.back();
+        parent.peak_memory = std::max(parent.peak_memory, memory);
+    }
+    m_running.push_back({m_records.size(), get_node_count(model), memory, memory, {}});
+    // the start is taken after the node count to exclude the profiling overhead
+    record.start = std::chrono::steady_clock::now() - m_start;
+    m_records.push_back(std::move(record));
+}
+
+void PassProfiler::end_pass(bool applied, const std::shared_ptr<Model>& model) noexcept {
+    const auto end = std::chrono::steady_clock::now() - m_start;
+    const auto running = std::move(m_running.back());
+    m_running.pop_back();
+
+    auto& record = m_records[running.record];
+    record.duration = end - record.start;
+    record.applied = applied;
+    if (!m_running.empty()) {
+        m_records[m_running.back().record].rewrites += record.rewrites;
+    }
+    // the statistics are left unset if they can't be collected, the profiling must not fail the transformation
+    try {
+        record.node_count_delta =
+            static_cast<int64_t>(get_node_count(model)) - static_cast<int64_t>(running.node_count);
+        const auto memory = get_memory_usage();
+        record.memory_delta = static_cast<int64_t>(memory) - static_cast<int64_t>(running.memory);
+        record.peak_memory = std::max(running.peak_memory, memory);
+        if (!m_running.empty()) {
+            auto& parent = m_running.back();
+            parent.peak_memory = std::max(parent.peak_memory, record.peak_memory);
+        }
+    } catch (...) {
+    }
+}
+
+void PassProfiler::add_matcher_run(const std::string& name, std::chrono::nanoseconds duration, bool applied) {
+    if (m_running.empty())
+        return;
+    auto& running = m_running.back();
+    auto& record = m_records[running.record];
+    auto it = running.matchers.find(name);
+    if (it == running.matchers.end()) {
+        it = running.matchers.emplace(name, record.matchers.size()).first;
+        record.matchers.emplace_back();
+        record.matchers.back().name = name;
+    }
+    auto& matcher = record.matchers[it->second];
+    matcher.calls++;
+    matcher.duration += duration;
+    if (applied) {
+        matcher.rewrites++;
+        record.rewrites++;
+    }
+}
+
+PassProfiler::Scope::Scope(PassProfiler* profiler, const std::string& name, const std::shared_ptr<Model>& model)
+    : m_profiler(profiler),
+      m_model(model) {
+    if (m_profiler)
+        m_profiler->begin_pass(name, m_model);
+}
+
+PassProfiler::Scope::~Scope() {
+    if (m_profiler)
+        m_profiler->end_pass(applied, m_model);
+}
+
+void write_chrome_trace(const std::vector<PassProfile>& records, std::ostream& stream) {
+    stream << "{\"traceEvents\":[";
+    for (size_t i = 0; i < records.size(); ++i) {
+        const auto& record = records[i];
+        stream << (i ? ",\n" : "\n");
+        stream << "{\"name\":\"" << escape_json(record.name) << "\",\"cat\":\"pass\",\"ph\":\"X\",\"pid\":0,\"tid\":0"
+               << ",\"ts\":" << to_microseconds(record.start) << ",\"dur\":" << to_microseconds(record.duration)
+               << ",\"args\":{\"applied\":" << (record.applied ? "true" : "false")
+               << ",\"rewrites\":" << record.rewrites << ",\"node_count_delta\":" << record.node_count_delta
+               << ",\"memory_delta\":" << record.memory_delta << ",\"peak_memory\":" << record.peak_memory;
+        if (!record.matchers.empty()) {
+            stream << ",\"matchers\":{";
+            for (size_t j = 0; j < record.matchers.size(); ++j) {
+                const auto& matcher = record.matchers[j];
+                stream << (j ? "," : "") << "\"" << escape_json(matcher.name) << "\":{\"calls\":" << matcher.calls
+                       << ",\"rewrites\":" << matcher.rewrites << ",\"dur\":" << to_microseconds(matcher.duration)
+                       << "}";
+            }
+            stream << "}";
+        }
+        stream << "}}";
+    }
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+}  // namespace pass
+}  // namespace ov
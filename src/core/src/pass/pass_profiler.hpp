@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/pass/manager.hpp"
+
+namespace ov {
+namespace pass {
+/// \brief Collects PassProfile records of the transformations run on the calling thread.
+///
+/// The profiler is active on the thread from construction to destruction, so the managers and the matchers
+/// run by the nested transformations add their records to the outermost profiled manager.
+class PassProfiler {
+    PassProfiler(PassProfiler const&) = delete;
+    PassProfiler& operator=(PassProfiler const&) = delete;
+
+public:
+    explicit PassProfiler(std::vector<PassProfile>& records);
+    ~PassProfiler();
+
+    /// \return Profiler active on the calling thread or nullptr if profiling is disabled
+    static PassProfiler* get_active();
+
+    void begin_pass(const std::string& name, const std::shared_ptr<Model>& model);
+    void end_pass(bool applied, const std::shared_ptr<Model>& model) noexcept;
+    void add_matcher_run(const std::string& name, std::chrono::nanoseconds duration, bool applied);
+
+    /// \brief Ends the transformation on the scope exit, including the skipped and failed transformations
+    class Scope {
+    public:
+        Scope(PassProfiler* profiler, const std::string& name, const std::shared_ptr<Model>& model);
+        ~Scope();
+
+        bool applied = false;
+
+    private:
+        PassProfiler* m_profiler;
+        const std::shared_ptr<Model>& m_model;
+    };
+
+private:
+    struct RunningPass {
+        size_t record;
+        size_t node_count;
+        size_t memory;
+        // maximum resident memory sampled at the start and the end of this and the nested transformations
+        size_t peak_memory;
+        std::unordered_map<std::string, size_t> matchers;
+    };
+
+    std::vector<PassProfile>& m_records;
+    std::vector<RunningPass> m_running;
+    std::chrono::steady_clock::time_point m_start;
+    PassProfiler* m_previous;
+};
+
+/// \brief Write profiling records in Chrome trace event format
+void write_chrome_trace(const std::vector<PassProfile>& records, std::ostream& stream);
+}  // namespace pass
+}  // namespace ov
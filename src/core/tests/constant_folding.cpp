@@ -4,6 +4,7 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <numeric>
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -654,6 +655,42 @@ TEST(constant_folding, const_convert) {
     }
 }
 
+TEST(constant_folding, const_convert_low_precision_blocks) {
+    // Convert is folded by blocks of 32768 elements, the count crosses two block boundaries and leaves the last byte
+    // of the packed types partially filled
+    const size_t count = 2 * 32768 + 13;
+    {
+        vector<uint8_t> in(count);
+        vector<float> expected(count);
+        for (size_t i = 0; i < count; i++) {
+            in[i] = static_cast<uint8_t>(i % 16);
+            expected[i] = static_cast<float>(i % 16);
+        }
+        test_const_convert<element::u4, element::f32>(in, expected);
+        test_const_convert<element::f32, element::u4>(expected, in);
+    }
+    {
+        vector<int8_t> in(count);
+        vector<float> expected(count);
+        for (size_t i = 0; i < count; i++) {
+            in[i] = static_cast<int8_t>(static_cast<int>(i % 16) - 8);
+            expected[i] = static_cast<float>(in[i]);
+        }
+        test_const_convert<element::i4, element::f32>(in, expected);
+        test_const_convert<element::f32, element::i4>(expected, in);
+    }
+    {
+        vector<uint8_t> in(count);
+        vector<float> expected(count);
+        for (size_t i = 0; i < count; i++) {
+            in[i] = static_cast<uint8_t>(i % 3 == 0);
+            expected[i] = static_cast<float>(in[i]);
+        }
+        test_const_convert<element::u1, element::f32>(in, expected);
+        test_const_convert<element::f32, element::u1>(expected, in);
+    }
+}
+
 TEST(constant_folding, shape_of_v0) {
     Shape input_shape{3, 4, 0, 22, 608, 909, 3};
 
@@ -2187,6 +2224,41 @@ TEST(constant_folding, const_gather_v7_subgraph_skip_if_not_single_input) {
     ASSERT_EQ(count_ops_of_type<op::v7::Gather>(f), 1);
 }
 
+TEST(constant_folding, const_gather_v8_negative_and_out_of_range_indices) {
+    auto constant_data = op::Constant::create(element::f32, Shape{2, 3}, vector<float>{1, 2, 3, 4, 5, 6});
+    // the negative indices are counted from the end, the output is zero for the out of range ones
+    auto constant_indices = op::Constant::create(element::i32, Shape{5}, vector<int32_t>{-1, 3, 0, -4, -3});
+    auto constant_axis = op::Constant::create(element::i64, Shape{}, vector<int64_t>{1});
+    auto gather = make_shared<op::v8::Gather>(constant_data, constant_indices, constant_axis);
+    auto f = make_shared<Function>(gather, ParameterVector{});
+
+    run_constant_folding(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v8::Gather>(f), 0);
+    auto new_const = get_result_constant(f);
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ((Shape{2, 5}), new_const->get_shape());
+    ASSERT_EQ((vector<float>{3, 0, 1, 0, 1, 6, 0, 4, 0, 4}), new_const->get_vector<float>());
+}
+
+TEST(constant_folding, const_gather_v8_batch_dims) {
+    vector<int64_t> data(2 * 3 * 4);
+    std::iota(data.begin(), data.end(), 0);
+    auto constant_data = op::Constant::create(element::i64, Shape{2, 3, 4}, data);
+    auto constant_indices = op::Constant::create(element::i64, Shape{2, 2}, vector<int64_t>{3, 0, 1, -1});
+    auto constant_axis = op::Constant::create(element::i64, Shape{}, vector<int64_t>{2});
+    auto gather = make_shared<op::v8::Gather>(constant_data, constant_indices, constant_axis, 1);
+    auto f = make_shared<Function>(gather, ParameterVector{});
+
+    run_constant_folding(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v8::Gather>(f), 0);
+    auto new_const = get_result_constant(f);
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ((Shape{2, 3, 2}), new_const->get_shape());
+    ASSERT_EQ((vector<int64_t>{3, 0, 7, 4, 11, 8, 13, 15, 17, 19, 21, 23}), new_const->get_vector<int64_t>());
+}
+
 TEST(constant_folding, const_strided_slice) {
     Shape shape_in{16};
 
@@ -3584,3 +3656,54 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, parallel_decompression_chains) {
+    // Several independent weights decompression chains are folded level by level in parallel. The sizes are large
+    // enough to split the folded operations into several blocks.
+    const size_t chains_num = 4, rows = 64, cols = 1024;
+    NodeVector results;
+    std::vector<std::weak_ptr<Node>> intermediate;
+    for (size_t chain = 0; chain < chains_num; chain++) {
+        vector<uint8_t> weights(rows * cols);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<uint8_t>((i + chain) % 251);
+        vector<float> scales(rows);
+        for (size_t i = 0; i < rows; i++)
+            scales[i] = static_cast<float>(i + chain + 1);
+
+        auto weights_const = make_shared<op::Constant>(element::u8, Shape{rows, cols}, weights);
+        auto convert = make_shared<op::Convert>(weights_const, element::f32);
+        auto scales_const = make_shared<op::Constant>(element::f32, Shape{rows, 1}, scales);
+        auto multiply = make_shared<op::v1::Multiply>(convert, scales_const);
+        auto order = make_shared<op::Constant>(element::i64, Shape{2}, vector<int64_t>{1, 0});
+        auto transpose = make_shared<op::Transpose>(multiply, order);
+        results.push_back(transpose);
+        intermediate.push_back(weights_const);
+        intermediate.push_back(convert);
+        intermediate.push_back(multiply);
+    }
+    auto model = make_shared<Function>(results, ParameterVector{});
+    results.clear();
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::Transpose>(model), 0);
+    for (size_t chain = 0; chain < chains_num; chain++) {
+        auto result_node = get_result_constant(model, chain);
+        ASSERT_TRUE(result_node);
+        ASSERT_EQ((Shape{cols, rows}), result_node->get_output_shape(0));
+        const auto values = result_node->cast_vector<float>();
+        for (size_t c = 0; c < cols; c++) {
+            for (size_t r = 0; r < rows; r++) {
+                const auto expected = static_cast<float>((r * cols + c + chain) % 251) * static_cast<float>(r + chain + 1);
+                ASSERT_EQ(expected, values[c * rows + r]) << "chain=" << chain << " r=" << r << " c=" << c;
+            }
+        }
+    }
+    // The folded nodes and the intermediate constants aren't kept after folding
+    for (const auto& node : intermediate) {
+        ASSERT_TRUE(node.expired());
+    }
+}
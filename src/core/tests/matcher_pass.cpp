@@ -7,6 +7,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <sstream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/rt_info.hpp>
 
@@ -104,3 +105,87 @@ TEST(pattern, matcher_pass) {
         ASSERT_TRUE(f->get_ops().size() == 3);
     }
 }
+
+namespace {
+class NestedReluFusion : public pass::FunctionPass {
+public:
+    NestedReluFusion() {
+        set_name("NestedReluFusion");
+    }
+    bool run_on_model(const std::shared_ptr<Function>& f) override {
+        pass::Manager manager;
+        manager.register_pass<TestMatcherPass>();
+        return manager.run_passes(f);
+    }
+};
+}  // namespace
+
+TEST(pattern, matcher_pass_profiling) {
+    std::shared_ptr<Function> f;
+    {
+        auto a = make_shared<opset3::Parameter>(element::f32, Shape{1});
+        auto b = make_shared<opset3::Relu>(a);
+        auto c = make_shared<opset3::Relu>(b);
+        auto d = make_shared<opset3::Relu>(c);
+        auto e = make_shared<opset3::Relu>(d);
+        f = std::make_shared<Function>(ngraph::NodeVector{e}, ParameterVector{a});
+    }
+
+    pass::Manager manager;
+    manager.set_profiling(true);
+    manager.register_pass<NestedReluFusion>();
+    manager.register_pass<pass::Validate>();
+    ASSERT_TRUE(manager.run_passes(f));
+    // Parameter->Relu->Result
+    ASSERT_EQ(f->get_ops().size(), 3u);
+
+    const auto& profile = manager.get_profile();
+    auto outer = std::find_if(profile.begin(), profile.end(), [](const pass::PassProfile& record) {
+        return record.name == "NestedReluFusion";
+    });
+    auto nested = std::find_if(profile.begin(), profile.end(), [](const pass::PassProfile& record) {
+        return record.name == "ReluReluFusion";
+    });
+    auto validate = std::find_if(profile.begin(), profile.end(), [](const pass::PassProfile& record) {
+        return record.name.find("Validate") != std::string::npos;
+    });
+    ASSERT_NE(outer, profile.end());
+    ASSERT_NE(nested, profile.end());
+    ASSERT_NE(validate, profile.end());
+
+    EXPECT_EQ(outer->depth, 0u);
+    EXPECT_TRUE(outer->applied);
+    EXPECT_EQ(outer->rewrites, 3u);
+    EXPECT_EQ(outer->node_count_delta, -3);
+    EXPECT_GE(outer->duration, nested->duration);
+    EXPECT_GE(outer->peak_memory, nested->peak_memory);
+#ifdef __linux__
+    EXPECT_GT(nested->peak_memory, 0u);
+#endif
+
+    EXPECT_EQ(nested->depth, 1u);
+    EXPECT_TRUE(nested->applied);
+    EXPECT_EQ(nested->rewrites, 3u);
+    EXPECT_EQ(nested->node_count_delta, -3);
+    EXPECT_GE(nested->start, outer->start);
+    ASSERT_EQ(nested->matchers.size(), 1u);
+    EXPECT_EQ(nested->matchers[0].name, "ReluReluFusion");
+    EXPECT_EQ(nested->matchers[0].rewrites, 3u);
+    EXPECT_GE(nested->matchers[0].calls, 3u);
+
+    // Validate reports its own result rather than the one of the previous transformation
+    EXPECT_EQ(validate->depth, 0u);
+    EXPECT_FALSE(validate->applied);
+
+    std::stringstream trace;
+    manager.export_profile(trace);
+    EXPECT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"name\":\"NestedReluFusion\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"ReluReluFusion\":{\"calls\""), std::string::npos);
+
+    // Profiling isn't collected when it is disabled
+    const auto records_num = profile.size();
+    manager.set_profiling(false);
+    manager.run_passes(f);
+    EXPECT_EQ(manager.get_profile().size(), records_num);
+}
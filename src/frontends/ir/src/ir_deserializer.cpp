@@ -4,6 +4,7 @@
 
 #include "ir_deserializer.hpp"
 
+#include <exception>
 #include <pugixml.hpp>
 #include <regex>
 
@@ -12,6 +13,8 @@
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/util/variable_extension.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -431,12 +434,26 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
+    std::vector<pugi::xml_node> layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back(node); }
+    // Layers are parsed in parallel, errors are rethrown in the order of the layers
+    std::vector<GenericLayerParams> layers_params(layers.size());
+    std::vector<std::exception_ptr> layers_errors(layers.size());
+    ov::parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers_params[i] = parse_generic_params(layers[i]);
+        } catch (...) {
+            layers_errors[i] = std::current_exception();
+        }
+    });
+    for (size_t i = 0; i < layers.size(); i++) {
+        if (layers_errors[i])
+            std::rethrow_exception(layers_errors[i]);
+        const auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        params[node_param.layerId] = {layers[i], node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -476,8 +493,21 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // Attributes and runtime info of the layers don't depend on the inputs, so they are read in parallel.
+    // Connection and validation of the nodes is done in one sweep in topological order below, errors of the
+    // parallel part are rethrown by create_node after the checks of the inputs, to report the same error as the
+    // sequential reading.
+    std::vector<LayerAttributes> layers_attributes(order.size());
+    ov::parallel_for(order.size(), [&](size_t i) {
+        const auto paramsIt = params.find(order[i]);
+        if (paramsIt == params.end() || edges.find(order[i]) == edges.end())
+            return;
+        layers_attributes[i] = read_layer_attributes(paramsIt->second.xml, weights, paramsIt->second.params);
+    });
+
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
+    for (size_t i = 0; i < order.size(); i++) {
+        const auto layer_id = order[i];
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
@@ -496,7 +526,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        auto node = create_node(inputs, p.xml, weights, p.params, layers_attributes[i]);
         id_to_node[layer_id] = node;
 
         // Check that output shape after OpenVINO node validation the same as in IR
@@ -753,32 +783,9 @@ static const std::string& translate_type_name(const std::string& name) {
     return name;
 }
 
-std::shared_ptr<ngraph::Node> XmlDeserializer::create_node(
-    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
-    const pugi::xml_node& node,
-    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-    const GenericLayerParams& params) {
-    // Check that inputs are correctly defined
-    for (size_t i = 0; i < inputs.size(); i++) {
-        if (!inputs[i].get_node())
-            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
-                       << " has incorrect input with index " << i << "!";
-        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
-            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
-                       << " has undefined element type for input with index " << i << "!";
-    }
-
+std::shared_ptr<ov::Node> XmlDeserializer::create_op(const GenericLayerParams& params) {
     const std::string& type_name = translate_type_name(params.type);
 
-    std::shared_ptr<ngraph::Node> ngraphNode;
-    ov::DiscreteTypeInfo type(type_name.c_str(), params.version.c_str());
-    auto extensionIt = m_extensions.find(type);
-
-    if (extensionIt != m_extensions.end()) {
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
-        ngraphNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
-    }
-
     // Find registered opset
     auto opsetIt = m_opsets.find(params.version);
 
@@ -798,37 +805,171 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::create_node(
         opsetIt = m_opsets.find("opset6");
     }
 
-    if (!ngraphNode && opsetIt != m_opsets.end()) {
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
-                opsetIt = m_opsets.find("opset2");
-                if (opsetIt == m_opsets.end()) {
-                    IE_THROW() << "Cannot create " << params.type << " layer " << params.name
-                               << " id:" << params.layerId << " from unsupported opset: " << params.version;
+    if (opsetIt == m_opsets.end())
+        return nullptr;
+
+    if (params.version == "opset1") {
+        // MVN, ROIPooling and ReorgYolo were missing in opset1
+        if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
+            opsetIt = m_opsets.find("opset2");
+            if (opsetIt == m_opsets.end()) {
+                IE_THROW() << "Cannot create " << params.type << " layer " << params.name << " id:" << params.layerId
+                           << " from unsupported opset: " << params.version;
+            }
+        }
+    }
+
+    auto const& opset = opsetIt->second;
+
+    auto ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type_name));
+    if (!ngraphNode) {
+        IE_THROW() << "Opset " << params.version << " doesn't contain the operation with type: " << type_name;
+    }
+    // Share Weights form constant blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(ngraphNode)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    return ngraphNode;
+}
+
+bool XmlDeserializer::visit_op_attributes(const std::shared_ptr<ov::Node>& op,
+                                          const pugi::xml_node& node,
+                                          const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
+    XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+    return op->visit_attributes(visitor);
+}
+
+static ov::RTMap read_rt_info(ov::pass::Attributes& attrs_factory, const pugi::xml_node& rt_attrs) {
+    ov::RTMap rt_info;
+    if (!rt_attrs)
+        return rt_info;
+    for (const auto& item : rt_attrs) {
+        std::string attribute_name, attribute_version;
+        // For view:
+        // <attribute name="old_api_map_order" version="0" value="0,3,1,2"/>
+        if (!getStrAttribute(item, "name", attribute_name)) {
+            std::stringstream ss;
+            item.print(ss);
+            IE_THROW() << "rt_info attribute has no \"name\" field: " << ss.str();
+        }
+        if (!getStrAttribute(item, "version", attribute_version)) {
+            std::stringstream ss;
+            item.print(ss);
+            IE_THROW() << "rt_info attribute: " << attribute_name << " has no \"version\" field: " << ss.str();
+        }
+        const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), attribute_version.c_str());
+        auto attr = attrs_factory.create_by_type_info(type_info);
+        if (!attr.empty()) {
+            if (attr.is<ov::RuntimeAttribute>()) {
+                RTInfoDeserializer attribute_visitor(item);
+                if (attr.as<ov::RuntimeAttribute>().visit_attributes(attribute_visitor)) {
+                    auto res = rt_info.emplace(type_info, attr);
+                    if (!res.second) {
+                        IE_THROW() << "multiple rt_info attributes are detected: " << attribute_name;
+                    }
+                } else {
+                    IE_THROW() << "VisitAttributes is not supported for: " << item.name() << " attribute";
                 }
+            } else {
+                IE_THROW() << "Attribute: " << item.name() << " is not recognized as runtime attribute";
             }
+        } else {
+            // As runtime attributes are optional, so we skip attribute if it is unknown to avoid exception
+            // when loading new IR with new attribute in old IE version.
         }
+    }
+    return rt_info;
+}
 
-        auto const& opset = opsetIt->second;
+XmlDeserializer::LayerAttributes XmlDeserializer::read_layer_attributes(
+    const pugi::xml_node& node,
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+    const GenericLayerParams& params) {
+    LayerAttributes attributes;
 
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type_name));
-        if (!ngraphNode) {
-            IE_THROW() << "Opset " << params.version << " doesn't contain the operation with type: " << type_name;
+    const std::string& type_name = translate_type_name(params.type);
+    if (!m_extensions.count(ov::DiscreteTypeInfo(type_name.c_str(), params.version.c_str()))) {
+        try {
+            auto op = create_op(params);
+            // Bodies and variables share the variables map between the visitors, so such operations are created
+            // during the sequential sweep
+            if (op && !std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op) &&
+                !std::dynamic_pointer_cast<ov::op::util::VariableExtension>(op)) {
+                attributes.validate = visit_op_attributes(op, node, weights);
+                attributes.node = op;
+            }
+        } catch (...) {
+            attributes.node_error = std::current_exception();
         }
-        // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(ngraphNode)) {
-            constant->alloc_buffer_on_visit_attributes(false);
+    }
+
+    // read runtime info only for IR v11+
+    if (m_version > 10) {
+        try {
+            ov::pass::Attributes attrs_factory;
+            attributes.rt_info = read_rt_info(attrs_factory, node.child("rt_info"));
+            FOREACH_CHILD (rt_node, node.child("output"), "port") {
+                attributes.outputs_rt_info.push_back(read_rt_info(attrs_factory, rt_node.child("rt_info")));
+            }
+            FOREACH_CHILD (rt_node, node.child("input"), "port") {
+                attributes.inputs_rt_info.push_back(read_rt_info(attrs_factory, rt_node.child("rt_info")));
+            }
+        } catch (...) {
+            attributes.rt_info_error = std::current_exception();
         }
-        ngraphNode->set_arguments(inputs);
+    }
+    return attributes;
+}
+
+std::shared_ptr<ngraph::Node> XmlDeserializer::create_node(
+    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+    const pugi::xml_node& node,
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+    const GenericLayerParams& params,
+    LayerAttributes& attributes) {
+    // Check that inputs are correctly defined
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!inputs[i].get_node())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " has incorrect input with index " << i << "!";
+        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " has undefined element type for input with index " << i << "!";
+    }
+
+    const std::string& type_name = translate_type_name(params.type);
+
+    std::shared_ptr<ngraph::Node> ngraphNode;
+    ov::DiscreteTypeInfo type(type_name.c_str(), params.version.c_str());
+    auto extensionIt = m_extensions.find(type);
+
+    if (extensionIt != m_extensions.end()) {
         XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        ngraphNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
+    }
 
-        if (ngraphNode->visit_attributes(visitor)) {
-            ngraphNode->constructor_validate_and_infer_types();
+    if (!ngraphNode) {
+        if (attributes.node_error)
+            std::rethrow_exception(attributes.node_error);
+        // The operation is released after cloning, so it doesn't stay in the targets of its inputs
+        auto op = std::move(attributes.node);
+        if (op) {
+            op->set_arguments(inputs);
+        } else {
+            op = create_op(params);
+            if (op) {
+                op->set_arguments(inputs);
+                attributes.validate = visit_op_attributes(op, node, weights);
+            }
         }
+        if (op) {
+            if (attributes.validate) {
+                op->constructor_validate_and_infer_types();
+            }
 
-        // To be sure that all default values will be initialized:
-        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+            // To be sure that all default values will be initialized:
+            ngraphNode = op->clone_with_new_inputs(op->input_values());
+        }
     }
     if (!ngraphNode && m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
         ngraphNode = std::make_shared<ov::op::util::FrameworkNode>(inputs);
@@ -867,71 +1008,28 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::create_node(
             ngraphNode->get_output_tensor(i).set_names(params.outputPorts[i].names);
     }
 
-    ov::pass::Attributes attrs_factory;
-    auto set_runtime_info = [&attrs_factory](RTMap& rt_info, const pugi::xml_node& rt_attrs) {
-        if (!rt_attrs)
-            return;
-        for (const auto& item : rt_attrs) {
-            std::string attribute_name, attribute_version;
-            // For view:
-            // <attribute name="old_api_map_order" version="0" value="0,3,1,2"/>
-            if (!getStrAttribute(item, "name", attribute_name)) {
-                std::stringstream ss;
-                item.print(ss);
-                IE_THROW() << "rt_info attribute has no \"name\" field: " << ss.str();
-            }
-            if (!getStrAttribute(item, "version", attribute_version)) {
-                std::stringstream ss;
-                item.print(ss);
-                IE_THROW() << "rt_info attribute: " << attribute_name << " has no \"version\" field: " << ss.str();
-            }
-            const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), attribute_version.c_str());
-            auto attr = attrs_factory.create_by_type_info(type_info);
-            if (!attr.empty()) {
-                if (attr.is<ov::RuntimeAttribute>()) {
-                    RTInfoDeserializer attribute_visitor(item);
-                    if (attr.as<ov::RuntimeAttribute>().visit_attributes(attribute_visitor)) {
-                        auto res = rt_info.emplace(type_info, attr);
-                        if (!res.second) {
-                            IE_THROW() << "multiple rt_info attributes are detected: " << attribute_name;
-                        }
-                    } else {
-                        IE_THROW() << "VisitAttributes is not supported for: " << item.name() << " attribute";
-                    }
-                } else {
-                    IE_THROW() << "Attribute: " << item.name() << " is not recognized as runtime attribute";
-                }
-            } else {
-                // As runtime attributes are optional, so we skip attribute if it is unknown to avoid exception
-                // when loading new IR with new attribute in old IE version.
+    auto set_runtime_info = [](RTMap& rt_info, const RTMap& attrs) {
+        for (const auto& attr : attrs) {
+            if (!rt_info.emplace(attr).second) {
+                IE_THROW() << "multiple rt_info attributes are detected: " << attr.first;
             }
         }
     };
 
-    // read runtime info only for IR v11+
-    if (m_version > 10) {
-        // set node runtime info attributes
-        set_runtime_info(ngraphNode->get_rt_info(), node.child("rt_info"));
-
-        // set output ports runtime info attributes
-        auto out_node = node.child("output");
-        if (!out_node.empty()) {
-            size_t index{0};
-            FOREACH_CHILD (rt_node, out_node, "port") {
-                set_runtime_info(ngraphNode->output(index).get_rt_info(), rt_node.child("rt_info"));
-                ++index;
-            }
-        }
+    if (attributes.rt_info_error)
+        std::rethrow_exception(attributes.rt_info_error);
 
-        // set input ports runtime info attributes
-        auto in_node = node.child("input");
-        if (!in_node.empty()) {
-            size_t index{0};
-            FOREACH_CHILD (rt_node, in_node, "port") {
-                set_runtime_info(ngraphNode->input(index).get_rt_info(), rt_node.child("rt_info"));
-                ++index;
-            }
-        }
+    // set node runtime info attributes
+    set_runtime_info(ngraphNode->get_rt_info(), attributes.rt_info);
+
+    // set output ports runtime info attributes
+    for (size_t index = 0; index < attributes.outputs_rt_info.size(); ++index) {
+        set_runtime_info(ngraphNode->output(index).get_rt_info(), attributes.outputs_rt_info[index]);
+    }
+
+    // set input ports runtime info attributes
+    for (size_t index = 0; index < attributes.inputs_rt_info.size(); ++index) {
+        set_runtime_info(ngraphNode->input(index).get_rt_info(), attributes.inputs_rt_info[index]);
     }
 
     return ngraphNode;
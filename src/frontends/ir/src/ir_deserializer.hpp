@@ -148,6 +148,23 @@ private:
         NodeIdToIoIndex outputs;
     };
 
+    /// \brief Parts of the layer which don't depend on the layer inputs, so they are read for all layers in
+    /// parallel before the nodes are connected.
+    struct LayerAttributes {
+        // Operation created from the opsets with visited attributes, but without inputs. It is empty if the
+        // operation has to be created when the inputs are known (extensions, framework nodes, bodies, variables).
+        std::shared_ptr<ov::Node> node;
+        // Result of visit_attributes which enables validation of the node
+        bool validate = false;
+        ov::RTMap rt_info;
+        std::vector<ov::RTMap> inputs_rt_info;
+        std::vector<ov::RTMap> outputs_rt_info;
+        // Errors of the operation creation and of the runtime info reading, create_node rethrows them at the
+        // points where the sequential reading throws them
+        std::exception_ptr node_error;
+        std::exception_ptr rt_info_error;
+    };
+
     /// \brief Traverses port_map in order to create vector of InputDescription shared_ptrs.
     /// Shall be used only for ops which have port_map attribute.
     /// \param node xml op representation
@@ -177,10 +194,25 @@ private:
 
     GenericLayerParams parse_generic_params(const pugi::xml_node& node);
 
+    /// \brief Creates the operation from the registered opsets
+    /// \return nullptr if the operation version isn't found in the opsets
+    std::shared_ptr<ov::Node> create_op(const GenericLayerParams& params);
+
+    bool visit_op_attributes(const std::shared_ptr<ov::Node>& op,
+                             const pugi::xml_node& node,
+                             const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights);
+
+    /// \brief Reads attributes and runtime info of the layer. It doesn't modify the shared state of the
+    /// deserializer, so it is safe to call it for several layers in parallel.
+    LayerAttributes read_layer_attributes(const pugi::xml_node& node,
+                                          const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                                          const GenericLayerParams& params);
+
     std::shared_ptr<ov::Node> create_node(const ov::OutputVector& inputs,
                                           const pugi::xml_node& node,
                                           const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-                                          const GenericLayerParams& params);
+                                          const GenericLayerParams& params,
+                                          LayerAttributes& attributes);
 
     void read_meta_data(const std::shared_ptr<ov::Model>& model, const pugi::xml_node& meta_section);
 
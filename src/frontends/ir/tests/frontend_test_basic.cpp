@@ -2,10 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <sstream>
+
+#include "common_test_utils/test_assertions.hpp"
 #include "frontend_test.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
 #include "openvino/opsets/opset6.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
 protected:
@@ -1387,3 +1392,360 @@ TEST_F(IRFrontendTests, DetectionOutput) {
     ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
     ASSERT_TRUE(!!model);
 }
+
+TEST_F(IRFrontendTests, long_chain_model_reading) {
+    // Layers are read in parallel and connected in topological order, the chain checks that the order of the nodes
+    // and their consumers are the same as for the sequential reading
+    const size_t chain_length = 200;
+    auto make_port = [](size_t id) {
+        return R"V0G0N(
+                <port id=")V0G0N" +
+               std::to_string(id) + R"V0G0N(" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>)V0G0N";
+    };
+
+    std::stringstream layers, edges;
+    layers << R"V0G0N(
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,16"/>
+            <output>)V0G0N"
+           << make_port(0) << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+    for (size_t i = 1; i <= chain_length; i++) {
+        layers << R"V0G0N(
+        <layer name="relu_)V0G0N"
+               << i << R"V0G0N(" type="ReLU" id=")V0G0N" << i << R"V0G0N(" version="opset1">
+            <input>)V0G0N"
+               << make_port(0) << R"V0G0N(
+            </input>
+            <output>)V0G0N"
+               << make_port(1) << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+        edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << i - 1 << R"V0G0N(" from-port=")V0G0N" << (i == 1 ? 0 : 1)
+              << R"V0G0N(" to-layer=")V0G0N" << i << R"V0G0N(" to-port="0"/>)V0G0N";
+    }
+    layers << R"V0G0N(
+        <layer name="output" type="Result" id=")V0G0N"
+           << chain_length + 1 << R"V0G0N(" version="opset1">
+            <input>)V0G0N"
+           << make_port(0) << R"V0G0N(
+            </input>
+        </layer>)V0G0N";
+    edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << chain_length << R"V0G0N(" from-port="1" to-layer=")V0G0N" << chain_length + 1
+          << R"V0G0N(" to-port="0"/>)V0G0N";
+
+    const std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>)V0G0N" + layers.str() + R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges.str() + R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+
+    std::shared_ptr<ov::Model> model;
+
+    ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
+    ASSERT_TRUE(!!model);
+
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        parameter->set_friendly_name("input");
+        std::shared_ptr<ov::Node> last = parameter;
+        for (size_t i = 1; i <= chain_length; i++) {
+            last = std::make_shared<ov::opset1::Relu>(last);
+            last->set_friendly_name("relu_" + std::to_string(i));
+        }
+        auto result = std::make_shared<ov::opset1::Result>(last);
+        result->set_friendly_name("output");
+        modelRef = std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{parameter});
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+
+    for (const auto& node : model->get_ordered_ops()) {
+        if (!ov::is_type<ov::opset1::Result>(node)) {
+            EXPECT_EQ(1, node->output(0).get_target_inputs().size()) << node->get_friendly_name();
+        }
+    }
+}
+
+TEST_F(IRFrontendTests, constants_and_rt_info_reading) {
+    // Constants and runtime info are read in parallel, the chain checks that each layer gets its own data
+    const size_t chain_length = 32;
+    const size_t size = 4;
+    auto make_port = [](size_t id, const std::string& fused_names) {
+        return R"V0G0N(
+                <port id=")V0G0N" +
+               std::to_string(id) + R"V0G0N(" precision="FP32">
+                    <rt_info>
+                        <attribute name="fused_names" version="0" value=")V0G0N" +
+               fused_names + R"V0G0N("/>
+                    </rt_info>
+                    <dim>4</dim>
+                </port>)V0G0N";
+    };
+
+    std::stringstream layers, edges;
+    layers << R"V0G0N(
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="4"/>
+            <output>)V0G0N"
+           << make_port(0, "input") << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+    std::vector<float> weights(chain_length * size);
+    for (size_t i = 1; i <= chain_length; i++) {
+        const auto idx = std::to_string(i);
+        for (size_t j = 0; j < size; j++)
+            weights[(i - 1) * size + j] = static_cast<float>(i * size + j);
+        layers << R"V0G0N(
+        <layer name="const_)V0G0N"
+               << idx << R"V0G0N(" type="Const" id=")V0G0N" << 2 * i << R"V0G0N(" version="opset1">
+            <data element_type="f32" shape="4" offset=")V0G0N"
+               << (i - 1) * size * sizeof(float) << R"V0G0N(" size=")V0G0N" << size * sizeof(float) << R"V0G0N("/>
+            <output>)V0G0N"
+               << make_port(0, "const_" + idx) << R"V0G0N(
+            </output>
+        </layer>
+        <layer name="add_)V0G0N"
+               << idx << R"V0G0N(" type="Add" id=")V0G0N" << 2 * i + 1 << R"V0G0N(" version="opset1">
+            <rt_info>
+                <attribute name="fused_names" version="0" value="add_)V0G0N"
+               << idx << R"V0G0N("/>
+            </rt_info>
+            <input>)V0G0N"
+               << make_port(0, "add_" + idx + "_in0") << make_port(1, "add_" + idx + "_in1") << R"V0G0N(
+            </input>
+            <output>)V0G0N"
+               << make_port(2, "add_" + idx + "_out") << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+        edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << (i == 1 ? 0 : 2 * i - 1) << R"V0G0N(" from-port=")V0G0N" << (i == 1 ? 0 : 2)
+              << R"V0G0N(" to-layer=")V0G0N" << 2 * i + 1 << R"V0G0N(" to-port="0"/>
+        <edge from-layer=")V0G0N" << 2 * i << R"V0G0N(" from-port="0" to-layer=")V0G0N" << 2 * i + 1
+              << R"V0G0N(" to-port="1"/>)V0G0N";
+    }
+    layers << R"V0G0N(
+        <layer name="output" type="Result" id=")V0G0N"
+           << 2 * chain_length + 2 << R"V0G0N(" version="opset1">
+            <input>)V0G0N"
+           << make_port(0, "output") << R"V0G0N(
+            </input>
+        </layer>)V0G0N";
+    edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << 2 * chain_length + 1 << R"V0G0N(" from-port="2" to-layer=")V0G0N"
+          << 2 * chain_length + 2 << R"V0G0N(" to-port="0"/>)V0G0N";
+
+    const std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>)V0G0N" + layers.str() + R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges.str() + R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<unsigned char> buffer(weights.size() * sizeof(float));
+    std::memcpy(buffer.data(), weights.data(), buffer.size());
+    createTemporalModelFile(testModel, buffer);
+
+    std::shared_ptr<ov::Model> model;
+
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    auto get_fused_names = [](const ov::RTMap& info) {
+        const auto it = info.find(ov::FusedNames::get_type_info_static());
+        return it == info.end() ? std::string{} : it->second.as<ov::FusedNames>().getNames();
+    };
+
+    size_t adds = 0;
+    for (const auto& node : model->get_ordered_ops()) {
+        const auto add = ov::as_type_ptr<ov::opset1::Add>(node);
+        if (!add)
+            continue;
+        adds++;
+        const auto& name = add->get_friendly_name();
+        ASSERT_EQ(0, name.find("add_"));
+        const auto i = std::stoul(name.substr(4));
+        EXPECT_EQ(name, get_fused_names(add->get_rt_info()));
+        EXPECT_EQ(name + "_in0", get_fused_names(add->input(0).get_rt_info()));
+        EXPECT_EQ(name + "_in1", get_fused_names(add->input(1).get_rt_info()));
+        EXPECT_EQ(name + "_out", get_fused_names(add->output(0).get_rt_info()));
+
+        const auto constant = ov::as_type_ptr<ov::opset1::Constant>(add->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(!!constant) << name;
+        EXPECT_EQ("const_" + std::to_string(i), constant->get_friendly_name());
+        EXPECT_EQ("const_" + std::to_string(i), get_fused_names(constant->output(0).get_rt_info()));
+        const auto values = constant->cast_vector<float>();
+        ASSERT_EQ(size, values.size());
+        for (size_t j = 0; j < size; j++)
+            EXPECT_EQ(weights[(i - 1) * size + j], values[j]) << name;
+    }
+    EXPECT_EQ(chain_length, adds);
+}
+
+TEST_F(IRFrontendTests, malformed_layer_attribute) {
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="convert" type="Convert" id="1" version="opset1">
+            <data destination_type="abc"/>
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    OV_EXPECT_THROW(getWithIRFrontend(testModel), std::runtime_error, testing::HasSubstr("Incorrect type: abc"));
+}
+
+TEST_F(IRFrontendTests, malformed_layer_attribute_with_incorrect_input) {
+    // The attributes are read before the inputs are connected, but the error of the inputs is reported first like
+    // for the sequential reading
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="undefined" shape="1,16"/>
+            <output>
+                <port id="0" precision="UNSPECIFIED">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="convert" type="Convert" id="1" version="opset1">
+            <data destination_type="abc"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    OV_EXPECT_THROW(getWithIRFrontend(testModel),
+                    std::runtime_error,
+                    testing::HasSubstr("has undefined element type for input with index 0"));
+}
+
+TEST_F(IRFrontendTests, malformed_rt_info) {
+    // The runtime info is read in parallel, its errors are reported when the layer is created
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" id="1" version="opset1">
+            <rt_info>
+                <attribute name="fused_names" version="0" value="relu"/>
+                <attribute name="fused_names" version="0" value="relu"/>
+            </rt_info>
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    OV_EXPECT_THROW(getWithIRFrontend(testModel),
+                    std::runtime_error,
+                    testing::HasSubstr("multiple rt_info attributes are detected: fused_names"));
+}
@@ -106,10 +106,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -237,13 +240,7 @@ private:
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
         if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
+            constant = make_external_ng_constant(type);
         } else if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
@@ -265,14 +262,18 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
-        auto data = get_data<T>();
-        auto data_size = data.size();
-        if (data_size == shape_size(m_shape)) {
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
-        } else if (data_size == 0 && m_shape.size() == 0) {
-            constant = common::make_failsafe_constant(type);
+        if (has_external_data()) {
+            constant = make_external_ng_constant(type);
         } else {
-            throw error::tensor::shape_doesnt_match_data_size{};
+            auto data = get_data<T>();
+            auto data_size = data.size();
+            if (data_size == shape_size(m_shape)) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+            } else if (data_size == 0 && m_shape.size() == 0) {
+                constant = common::make_failsafe_constant(type);
+            } else {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
         }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
@@ -280,6 +281,34 @@ private:
         return constant;
     }
 
+    // The external data is stored as raw bytes in the layout of the constant for all the types,
+    // with the mmap cache the constant shares the mapped file instead of a copy
+    std::shared_ptr<ngraph::op::Constant> make_external_ng_constant(const element::Type& type) const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        const size_t byte_size = shape_size(m_shape) * type.size();
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (m_mmap_cache) {
+            auto buffer = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            if (buffer->size() != byte_size) {
+                throw_external_data_size_mismatch();
+            }
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        } else {
+            auto external_data = tensor_external_data.load_external_data(m_model_dir);
+            if (external_data.size() != byte_size) {
+                throw_external_data_size_mismatch();
+            }
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
+        }
+        return constant;
+    }
+
+    void throw_external_data_size_mismatch() const {
+        throw error::invalid_external_data(
+            "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+            "' in the model");
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
@@ -337,6 +366,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
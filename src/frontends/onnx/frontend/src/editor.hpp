@@ -17,6 +17,7 @@
 #include "openvino/frontend/extension/holder.hpp"
 #include "openvino/frontend/extension/progress_reporter.hpp"
 #include "openvino/frontend/extension/telemetry.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace onnx_editor {
@@ -31,9 +32,14 @@ public:
     ///        is parsed and loaded into the m_model_proto member variable.
     ///
     /// \param model_path Path to the file containing the model.
-    ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions = {});
+    /// \param enable_mmap Map the files with the external data to memory instead of reading them.
+    ONNXModelEditor(const std::string& model_path,
+                    frontend::ExtensionHolder extensions = {},
+                    const bool enable_mmap = false);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    ONNXModelEditor(const std::wstring& model_path, frontend::ExtensionHolder extensions = {});
+    ONNXModelEditor(const std::wstring& model_path,
+                    frontend::ExtensionHolder extensions = {},
+                    const bool enable_mmap = false);
 #endif
 
     /// \brief Creates an editor from a model stream. The stream is parsed and loaded
@@ -42,9 +48,11 @@ public:
     /// \param model_stream The stream containing the model.
     /// \param model_path Path to the file containing the model. This information can be used
     ///                   for ONNX external weights feature support.
+    /// \param enable_mmap Map the files with the external data to memory instead of reading them.
     ONNXModelEditor(std::istream& model_stream,
                     const std::string& path = {},
-                    frontend::ExtensionHolder extensions = {});
+                    frontend::ExtensionHolder extensions = {},
+                    const bool enable_mmap = false);
 
     /// \brief Modifies the in-memory representation of the model by setting
     ///        custom input types for all inputs specified in the provided map.
@@ -298,6 +306,7 @@ private:
 
     frontend::ExtensionHolder m_extensions;
     const std::string m_model_path;
+    std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>> m_mmap_cache;
 
     struct Impl;
     std::unique_ptr<Impl, void (*)(Impl*)> m_pimpl;
@@ -46,14 +46,17 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     if (variants.empty()) {
         return nullptr;
     }
+    // the same flag as for the IR frontend: the external data files are mapped to memory
+    const bool enable_mmap =
+        variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
     if (variants[0].is<std::string>()) {
         const auto path = variants[0].as<std::string>();
-        return std::make_shared<InputModel>(path, m_extensions);
+        return std::make_shared<InputModel>(path, m_extensions, enable_mmap);
     }
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     if (variants[0].is<std::wstring>()) {
         const auto path = variants[0].as<std::wstring>();
-        return std::make_shared<InputModel>(path, m_extensions);
+        return std::make_shared<InputModel>(path, m_extensions, enable_mmap);
     }
 #endif
     if (variants[0].is<std::istream*>()) {
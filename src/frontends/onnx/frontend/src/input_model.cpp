@@ -15,12 +15,12 @@ using namespace ov::frontend::onnx;
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
-InputModel::InputModel(const std::string& path, frontend::ExtensionHolder extensions)
-    : m_editor{std::make_shared<onnx_editor::ONNXModelEditor>(path, std::move(extensions))} {}
+InputModel::InputModel(const std::string& path, frontend::ExtensionHolder extensions, const bool enable_mmap)
+    : m_editor{std::make_shared<onnx_editor::ONNXModelEditor>(path, std::move(extensions), enable_mmap)} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-InputModel::InputModel(const std::wstring& path, frontend::ExtensionHolder extensions)
-    : m_editor{std::make_shared<onnx_editor::ONNXModelEditor>(path, std::move(extensions))} {}
+InputModel::InputModel(const std::wstring& path, frontend::ExtensionHolder extensions, const bool enable_mmap)
+    : m_editor{std::make_shared<onnx_editor::ONNXModelEditor>(path, std::move(extensions), enable_mmap)} {}
 #endif
 
 InputModel::InputModel(std::istream& model_stream, frontend::ExtensionHolder extensions)
@@ -16,9 +16,10 @@ namespace onnx {
 
 class InputModel : public ov::frontend::InputModel {
 public:
-    InputModel(const std::string& path, ExtensionHolder extensions = {});
+    // enable_mmap maps the files with the external data to memory instead of reading them
+    InputModel(const std::string& path, ExtensionHolder extensions = {}, const bool enable_mmap = false);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    InputModel(const std::wstring& path, ExtensionHolder extensions = {});
+    InputModel(const std::wstring& path, ExtensionHolder extensions = {}, const bool enable_mmap = false);
 #endif
     InputModel(std::istream& model_stream, ExtensionHolder extensions = {});
     // The path can be required even if the model is passed as a stream because it is necessary
@@ -10,6 +10,7 @@
 #include "legacy_conversion_extension.hpp"
 #include "ngraph/function.hpp"
 #include "openvino/frontend/extension/holder.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ONNX_NAMESPACE {
 class ModelProto;
@@ -29,12 +30,15 @@ namespace detail {
 /// \param      model_proto Reference to a GraphProto object.
 /// \param      model_path  The path to the imported onnx model.
 ///                         It is required if the imported model uses data saved in external files.
+/// \param      mmap_cache  Files with the external data mapped to memory, nullptr to read the external data
+///                         into the constants instead of mapping it.
 /// \param      extensions An object containing a collection of frontend extensions to use during the import process
 ///
 /// \return     An nGraph function that represents a single output from the created
 /// graph.
 std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                             const std::string& model_path,
+                                            detail::MappedMemoryHandles mmap_cache,
                                             ov::frontend::ExtensionHolder extensions = {});
 
 /// \brief      Decode ONNX model to nGraph function with ONNXFrameworkNode(s)
@@ -42,11 +46,14 @@ std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::Mode
 /// \param      model_proto Reference to a GraphProto object.
 /// \param      model_path  The path to the imported onnx model.
 ///                         It is required if the imported model uses data saved in external files.
+/// \param      mmap_cache  Files with the external data mapped to memory, nullptr to read the external data
+///                         into the constants instead of mapping it.
 /// \param      extensions An object containing a collection of frontend extensions to use during the import process
 ///
 /// \return     A nGraph function with ONNXFrameworkNodes
 std::shared_ptr<Function> decode_to_framework_nodes(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                                     const std::string& model_path,
+                                                    detail::MappedMemoryHandles mmap_cache,
                                                     ov::frontend::ExtensionHolder extensions = {});
 
 /// \brief     Converts a nGraph function (onnx model decoded to function with ONNXFrameworkNode(s))
@@ -6,9 +6,21 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  External data files mapped to memory, shared by all the tensors of a model so that
+///         each file is mapped only once
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
+using MappedMemoryBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +35,17 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       If mapping the external file fails or the data doesn't fit the file,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      cache  Already mapped files, the file of the tensor is added if it's absent
+    ///
+    /// \return     Buffer sharing the mapped memory of the external file, no data is copied
+    std::shared_ptr<MappedMemoryBuffer> load_external_mmap_data(const std::string& model_dir,
+                                                                const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -9,7 +9,9 @@
 #include <algorithm>
 #include <fstream>
 #include <ie_core.hpp>
+#include <map>
 #include <ngraph/ngraph.hpp>
+#include <openvino/frontend/manager.hpp>
 #include <set>
 #include <streambuf>
 #include <string>
@@ -51,6 +53,30 @@ TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromFile) {
     ASSERT_TRUE(external_data_node_const->get_vector<float>() == (std::vector<float>{1, 2, 3, 4}));
 }
 
+TEST(ONNX_Reader_Tests, ImportModelWithExternalDataMapped) {
+    ov::frontend::FrontEndManager manager;
+    auto frontend = manager.load_by_framework("onnx");
+    ASSERT_NE(frontend, nullptr);
+    const auto path = CommonTestUtils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "external_data/external_data_two_tensors_data_in_the_same_file.onnx");
+    // the last bool argument enables the mapping of the external data files as for the IR frontend
+    auto input_model = frontend->load(path, true);
+    ASSERT_NE(input_model, nullptr);
+    const auto function = frontend->convert(input_model);
+
+    std::map<std::string, std::shared_ptr<ov::op::v0::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op))
+            constants[constant->get_friendly_name()] = constant;
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    EXPECT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+    EXPECT_EQ(constants["data_b"]->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+    // both tensors share the single mapping of the file
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+}
+
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromStringException) {
     InferenceEngine::Core ie;
     const auto path =
@@ -7,6 +7,7 @@
 #include "helper_ops/string_constant.hpp"
 #include "helper_ops/unsupported_constant.hpp"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset8.hpp"
 #include "tensor_bundle.pb.h"
 
@@ -19,29 +20,36 @@ namespace frontend {
 namespace tensorflow {
 namespace op {
 
-// Reading variable from shard file
+// Reading variable from shard file, the constant shares the mapped shard file and keeps the stored type,
+// a cast of it to a wider float type is left to the plugin (see translate_cast_op)
 template <typename T>
 static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<SavedModelVariablesIndex> var_index,
                                                const ov::element::Type ov_type,
                                                const ov::Shape shape,
                                                const ::tensorflow::BundleEntryProto& entry,
                                                const NodeContext& node) {
-    std::vector<T> var_data;
     google::protobuf::int64 size = 1;
     for (uint64_t i = 0; i < shape.size(); ++i) {
         size *= static_cast<google::protobuf::int64>(shape[i]);
     }
-    var_data.resize(size);
     TENSORFLOW_OP_VALIDATION(node,
                              size == static_cast<google::protobuf::int64>(entry.size() / sizeof(T)),
                              "[TensorFlow Frontend] Internal error: Available data size isn't equal to calculated.");
-    auto fs = var_index->get_data_file(entry.shard_id());
-    if (!fs.get()) {
-        TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
-    }
-    fs->seekg(entry.offset(), std::ios::beg);
-    fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
-    return std::make_shared<Constant>(ov_type, shape, var_data);
+    auto mapped_memory = var_index->get_data_file(entry.shard_id());
+    TENSORFLOW_OP_VALIDATION(node, mapped_memory.get(), "[TensorFlow Frontend] Internal error: Cannot get shard file.");
+    TENSORFLOW_OP_VALIDATION(node,
+                             entry.offset() >= 0 && entry.size() >= 0,
+                             "[TensorFlow Frontend] Internal error: Variable has negative offset or size.");
+    const auto offset = static_cast<size_t>(entry.offset());
+    const auto byte_size = static_cast<size_t>(entry.size());
+    TENSORFLOW_OP_VALIDATION(node,
+                             offset <= mapped_memory->size() && byte_size <= mapped_memory->size() - offset,
+                             "[TensorFlow Frontend] Internal error: Variable is out of the shard file.");
+    auto shared_buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MappedMemory>>>(
+        mapped_memory->data() + offset,
+        byte_size,
+        mapped_memory);
+    return std::make_shared<Constant>(ov_type, shape, shared_buffer);
 }
 
 OutputVector translate_varhandle_op(const NodeContext& node) {
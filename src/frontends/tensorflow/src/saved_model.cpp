@@ -207,22 +207,26 @@ void SavedModelVariablesIndex::read_checkpointable_object_graph() {
     auto shard = m_data_files.find(entry.shard_id());
     FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
 
-    std::vector<char> data(entry.size());
     ::tensorflow::TrackableObjectGraph tog;
 
     // TODO: have to understand this offset
     // It looks like reinterpret_cast artifact
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L70
     int chg = 6;
-    shard->second->seekg(entry.offset() + chg);
-    shard->second->read(data.data(), entry.size() - chg);
+    FRONT_END_GENERAL_CHECK(entry.offset() >= 0 && entry.size() >= chg,
+                            "CMO: Checkpointable Object Graph has wrong offset or size");
+    const auto offset = static_cast<size_t>(entry.offset());
+    FRONT_END_GENERAL_CHECK(offset <= shard->second->size() &&
+                                static_cast<size_t>(entry.size()) <= shard->second->size() - offset,
+                            "CMO: Checkpointable Object Graph is out of the data file");
+    const char* data = shard->second->data() + entry.offset() + chg;
 
     // Might be need to remove this verification:
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L73
     // FRONT_END_GENERAL_CHECK(tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg), "CMO: Trackable
     // Object Graph couldn't be read");
 
-    tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    tog.ParseFromArray(data, static_cast<int>(entry.size()) - chg);
 
     for (const auto& node : tog.nodes()) {
         for (const auto& attr : node.attributes()) {
@@ -265,9 +269,8 @@ bool SavedModelVariablesIndex::read_variables(std::ifstream& vi_stream, const st
     for (int32_t shard = 0; shard < m_total_shards; ++shard) {
         std::snprintf(suffix.data(), suffix.size(), "data-%05d-of-%05d", shard, m_total_shards);
         std::string fullPath = ov::util::path_join({path, "variables", std::string("variables.") + suffix.data()});
-        m_data_files[shard] =
-            std::shared_ptr<std::ifstream>(new std::ifstream(fullPath, std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Saved Model's variable index file does not exist");
+        FRONT_END_GENERAL_CHECK(ov::util::file_exists(fullPath), "Saved Model's variable index file does not exist");
+        m_data_files[shard] = ov::load_mmap_object(fullPath);
     }
 
     read_checkpointable_object_graph();
@@ -285,9 +288,8 @@ bool SavedModelVariablesIndex::read_variables(std::ifstream& vi_stream, const st
         swprintf_s(suffix.data(), suffix.size(), L"data-%05d-of-%05d", shard, m_total_shards);
         std::wstring fullPath =
             ov::util::path_join_w({path, L"variables", std::wstring(L"variables.") + suffix.data()});
-        m_data_files[shard] =
-            std::shared_ptr<std::ifstream>(new std::ifstream(fullPath, std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Saved Model's variable index file does not exist");
+        FRONT_END_GENERAL_CHECK(ov::util::file_exists(fullPath), "Saved Model's variable index file does not exist");
+        m_data_files[shard] = ov::load_mmap_object(fullPath);
     }
 
     read_checkpointable_object_graph();
@@ -7,6 +7,10 @@
 #include <openvino/frontend/manager.hpp>
 #include <openvino/opsets/opset10.hpp>
 #include <transformations/common_optimizations/moc_transformations.hpp>
+#include <transformations/rt_info/decompression.hpp>
+
+#include <fstream>
+#include <sstream>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "gtest/gtest.h"
@@ -72,6 +76,25 @@ ov::OutputVector fake_translator_ragged_tensor_to_sparse(const ov::frontend::Nod
 
     return {mul, add, sub};
 }
+
+// returns the file mapped at the address, only Linux exposes the mappings of the process
+string get_mapped_file(const void* address) {
+    const auto addr = reinterpret_cast<uintptr_t>(address);
+    ifstream maps("/proc/self/maps");
+    string line;
+    while (getline(maps, line)) {
+        uintptr_t begin = 0, end = 0;
+        istringstream range(line);
+        range >> hex >> begin;
+        range.ignore(1);
+        range >> hex >> end;
+        if (begin <= addr && addr < end) {
+            const auto path = line.find('/');
+            return path == string::npos ? string() : line.substr(path);
+        }
+    }
+    return {};
+}
 }  // namespace
 
 TEST(FrontEndConvertTrickyModels, undefined_input_shape) {
@@ -465,3 +488,53 @@ TEST_F(TransformationTestsF, RaggedTensorToSparse) {
         model_ref = make_shared<Model>(OutputVector{concat}, ParameterVector{row_splits, strings});
     }
 }
+
+TEST(FrontEndConvertTrickyModels, saved_model_variables) {
+    shared_ptr<Model> model;
+    try {
+        model = convert_model("saved_model_variables");
+    } catch (std::exception& ex) {
+        ASSERT_TRUE(false) << ex.what();
+    }
+
+    shared_ptr<Constant> weights, bias;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto constant = as_type_ptr<Constant>(node)) {
+            if (constant->get_shape() == Shape{64, 32}) {
+                weights = constant;
+            } else if (constant->get_shape() == Shape{32}) {
+                bias = constant;
+            }
+        }
+    }
+    ASSERT_TRUE(weights);
+    ASSERT_TRUE(bias);
+
+    // the variables keep the stored type, the cast of the f16 one is left to the plugin
+    EXPECT_EQ(weights->get_element_type(), f32);
+    EXPECT_EQ(bias->get_element_type(), f16);
+    const auto bias_consumers = bias->get_output_target_inputs(0);
+    ASSERT_EQ(bias_consumers.size(), 1);
+    auto bias_convert = bias_consumers.begin()->get_node()->shared_from_this();
+    ASSERT_TRUE(as_type_ptr<Convert>(bias_convert));
+    EXPECT_TRUE(is_decompression(bias_convert));
+
+    const auto weights_data = weights->get_data_ptr<float>();
+    for (size_t i = 0; i < 64 * 32; ++i) {
+        ASSERT_EQ(weights_data[i], static_cast<float>(i) / 1024.0f);
+    }
+    const auto bias_data = bias->get_data_ptr<ov::float16>();
+    for (size_t i = 0; i < 32; ++i) {
+        ASSERT_EQ(static_cast<float>(bias_data[i]), static_cast<float>(i) / 8.0f);
+    }
+
+#if defined(__linux__)
+    // the constants are the views over the mapped shard file, not the copies of the variables
+    const string shard_name = "variables.data-00000-of-00001";
+    for (const auto& constant : {weights, bias}) {
+        const auto mapped_file = get_mapped_file(constant->get_data_ptr());
+        ASSERT_GE(mapped_file.size(), shard_name.size());
+        EXPECT_EQ(mapped_file.substr(mapped_file.size() - shard_name.size()), shard_name);
+    }
+#endif
+}
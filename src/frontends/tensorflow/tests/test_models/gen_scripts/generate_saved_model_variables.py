@@ -0,0 +1,29 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import numpy as np
+import tensorflow as tf
+
+
+class ModelWithVariables(tf.Module):
+    def __init__(self):
+        super().__init__()
+        self.weights = tf.Variable(np.arange(64 * 32, dtype=np.float32).reshape([64, 32]) / 1024.0, name="weights")
+        self.bias = tf.Variable(np.arange(32, dtype=np.float16) / 8.0, name="bias")
+
+    @tf.function(input_signature=[tf.TensorSpec([2, 64], tf.float32, name="x")])
+    def __call__(self, x):
+        return tf.matmul(x, self.weights) + tf.cast(self.bias, tf.float32)
+
+
+def main():
+    module = ModelWithVariables()
+    tf.saved_model.save(module, os.path.join(sys.argv[1], "saved_model_variables"),
+                        signatures=module.__call__.get_concrete_function())
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,7 @@
 
 #include "common_op_table.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "transformations/rt_info/decompression.hpp"
 
 using namespace std;
 using namespace ov::opset8;
@@ -18,6 +19,13 @@ OutputVector translate_cast_op(const NodeContext& node) {
 
     auto ng_et = node.get_attribute<element::Type>("DstT");
     auto res = make_shared<Convert>(ng_input, ng_et);
+    // a cast of the low precision weights is kept as decompression, so the constant isn't folded to the wider type
+    // during the conversion and the plugin decides on the precision of the weights
+    const auto input_type = ng_input.get_element_type();
+    if (ov::as_type_ptr<Constant>(ng_input.get_node_shared_ptr()) &&
+        (input_type == element::f16 || input_type == element::bf16) && ng_et == element::f32) {
+        mark_as_decompression(res);
+    }
     set_node_name(node.get_name(), res);
     return res->outputs();
 }
@@ -95,6 +95,107 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines whether the graphs of all the CPU executor streams of a compiled model share one runtime parameters
+ * cache, so that each JIT kernel and oneDNN primitive is generated once per model instead of once per stream.
+ * Accepted values are PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARING);
+
+/**
+ * @brief Defines whether the CPU plugin is allowed to execute independent nodes of a static graph concurrently
+ * on the stream's threads. Accepted values are PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_NODES_EXECUTION);
+
+/**
+ * @brief Defines whether the CPU plugin is allowed to run the independent per-node phases of the graph compilation
+ * (descriptors enumeration, primitives creation) concurrently. Accepted values are PluginConfigParams::YES (default)
+ * or PluginConfigParams::NO.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAPH_COMPILATION);
+
+/**
+ * @brief Defines how many input shapes combinations are remembered by a dynamic CPU graph per stream together with
+ * the output shapes of all the nodes, so that the shape inference is skipped for the repeated input shapes.
+ * The values of the small graph inputs read by the shape inference (e.g. a Reshape pattern) are remembered as well.
+ * The cache isn't used if the shapes depend on the state values or on the values defined in runtime (NonZero etc.).
+ * Zero value disables the cache.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_CACHE_CAPACITY);
+
+/**
+ * @brief Read-only compiled model property. Returns the number of hits and misses of the CPU shapes cache summed
+ * over all the streams as std::vector<uint64_t>{hits, misses}
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_CACHE_STATISTICS);
+
+/**
+ * @brief Defines how the weights of a compiled model are placed in memory when its CPU streams run on several NUMA
+ * nodes:
+ *      @param ALWAYS - each NUMA node keeps own copy of the weights (default)
+ *      @param NEVER - the weights are stored once and shared by all the nodes
+ *      @param BUDGET - the weights are copied to each node only if the copies take no more than
+ *      CPU_WEIGHTS_REPLICATION_BUDGET bytes in total, otherwise they are shared. The size of the weights is
+ *      the size of the weights cached by the first compiled stream graph, i.e. after they are repacked by the nodes
+ *      @param INTERLEAVE - the weights are stored once with the memory pages interleaved over all the nodes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_REPLICATION);
+DECLARE_CONFIG_VALUE(ALWAYS);
+DECLARE_CONFIG_VALUE(NEVER);
+DECLARE_CONFIG_VALUE(BUDGET);
+DECLARE_CONFIG_VALUE(INTERLEAVE);
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_REPLICATION_BUDGET);
+
+/**
+ * @brief Read-only compiled model properties: the bytes of the weights placed on each NUMA node as
+ * std::vector<uint64_t> (in the order of the node ids) and the estimated share of the weights accesses of the streams
+ * that go to the memory of the other NUMA nodes as float
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_BYTES_PER_NUMA_NODE);
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_REMOTE_ACCESS_RATIO);
+
+/**
+ * @brief Auto-batching configuration: the target p99 latency of the requests (in ms), e.g. "50".
+ * When set, the time to collect the batch (and the batch size for the dynamic networks) is adapted at runtime to the
+ * observed arrival rate of the requests and the device latency per batch size. Zero value (default) disables that.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET);
+
+/**
+ * @brief Auto-batching configuration: whether the requests of a dynamic network may be packed (concatenated by the
+ * 0th dim) when the inputs/outputs have no layout telling the 0th dim is the batch ('N'). Accepted values are
+ * PluginConfigParams::YES or PluginConfigParams::NO (default). Without the layout or this opt-in the dynamic networks
+ * are executed without the batching, since the 0th dim may be e.g. a sequence length or a boxes count.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_PACK_DYNAMIC_REQUESTS);
+
+/**
+ * @brief Read-only auto-batching compiled model properties: the currently chosen time to collect the batch (in ms)
+ * and the batch size, as unsigned int
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_CURRENT_TIMEOUT);
+DECLARE_CONFIG_KEY(AUTO_BATCH_CURRENT_BATCH_SIZE);
+
+/**
+ * @brief Read-only auto-batching compiled model properties: the histograms of the end-to-end latency of the requests
+ * and of the time between the requests arrivals as std::vector<uint64_t> counters of the [0, 1), [1, 2), [2, 4) ... ms
+ * buckets
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_HISTOGRAM);
+DECLARE_CONFIG_KEY(AUTO_BATCH_ARRIVAL_HISTOGRAM);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
@@ -105,6 +206,15 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
 
+/**
+ * @brief Read-only plugin metric: true when the plugin can map the weights of the imported model from the cache file
+ * instead of reading them. For such plugins the core passes the path to the cache file as CACHED_BLOB_PATH
+ * configuration of the import
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CACHING_WITH_MMAP);
+DECLARE_CONFIG_KEY(CACHED_BLOB_PATH);
+
 /**
  * @brief Defines Snippets tokenization mode
  *      @param ENABLE - default pipeline
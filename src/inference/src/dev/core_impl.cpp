@@ -65,6 +65,17 @@ bool is_virtual_device(const std::string& device_name) {
             device_name.find("HETERO") != std::string::npos || device_name.find("BATCH") != std::string::npos);
 };
 
+bool device_supports_caching_with_mmap(const ov::Plugin& plugin) {
+    try {
+        auto supportedMetricKeys =
+            plugin.get_property(METRIC_KEY(SUPPORTED_METRICS), {}).as<std::vector<std::string>>();
+        return ov::util::contains(supportedMetricKeys, CONFIG_KEY_INTERNAL(CACHING_WITH_MMAP)) &&
+               plugin.get_property(CONFIG_KEY_INTERNAL(CACHING_WITH_MMAP), {}).as<bool>();
+    } catch (...) {
+        return false;
+    }
+}
+
 ov::AnyMap clone_map(const ov::AnyMap& m) {
     ov::AnyMap rm;
     for (auto&& kvp : m) {
@@ -1178,6 +1189,12 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
     struct HeaderException {};
 
     OPENVINO_ASSERT(cacheContent.cacheManager != nullptr);
+    // the plugin may map the weights right from the cache file instead of reading them from the stream
+    auto import_config = config;
+    const auto blob_path = cacheContent.cacheManager->get_cache_entry_path(cacheContent.blobId);
+    if (!blob_path.empty() && device_supports_caching_with_mmap(plugin)) {
+        import_config[CONFIG_KEY_INTERNAL(CACHED_BLOB_PATH)] = blob_path;
+    }
     try {
         cacheContent.cacheManager->read_cache_entry(cacheContent.blobId, [&](std::istream& networkStream) {
             OV_ITT_SCOPE(FIRST_INFERENCE,
@@ -1198,8 +1215,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
                 throw HeaderException();
             }
 
-            compiled_model = context._impl ? plugin.import_model(networkStream, context, config)
-                                           : plugin.import_model(networkStream, config);
+            compiled_model = context._impl ? plugin.import_model(networkStream, context, import_config)
+                                           : plugin.import_model(networkStream, import_config);
             if (auto wrapper = std::dynamic_pointer_cast<InferenceEngine::ICompiledModelWrapper>(compiled_model._ptr)) {
                 wrapper->get_executable_network()->loadedFromCache();
             }
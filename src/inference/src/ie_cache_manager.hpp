@@ -70,6 +70,18 @@ public:
      * @param id Id of cache (hash of the network)
      */
     virtual void remove_cache_entry(const std::string& id) = 0;
+
+    /**
+     * @brief Returns path to the file that stores the cache entry, if any
+     *
+     * The file can be memory mapped by the plugin while the entry is read
+     *
+     * @param id Id of cache (hash of the network)
+     * @return Path to the file or empty string if the entry is not stored in a file
+     */
+    virtual std::string get_cache_entry_path(const std::string& id) const {
+        return {};
+    }
 };
 
 /**
@@ -117,6 +129,10 @@ private:
         if (FileUtils::fileExist(blobFileName))
             std::remove(blobFileName.c_str());
     }
+
+    std::string get_cache_entry_path(const std::string& id) const override {
+        return getBlobFile(id);
+    }
 };
 
 }  // namespace ov
@@ -5,9 +5,11 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -18,6 +20,7 @@
 #include "ie_icore.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_performance_hints.hpp"
+#include "openvino/core/layout.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/device_id_parser.hpp"
 #include "openvino/runtime/intel_gpu/properties.hpp"
@@ -32,7 +35,9 @@ using namespace InferenceEngine;
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
-                                                 CONFIG_KEY(CACHE_DIR)};
+                                                 CONFIG_KEY(CACHE_DIR),
+                                                 PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET,
+                                                 PluginConfigInternalParams::KEY_AUTO_BATCH_PACK_DYNAMIC_REQUESTS};
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -69,7 +74,9 @@ AutoBatchInferRequest::AutoBatchInferRequest(const std::vector<std::shared_ptr<c
       _myBatchedRequestWrapper(workerRequest),
       _batchId(batch_id),
       _batchSize(num_batch) {
-    ShareBlobsWithBatchRequest(batchedInputs, batchedOutputs);
+    // with the packing, the blobs are set by the user and copied to/from the blobs of the batched request
+    if (!workerRequest._packRequests)
+        ShareBlobsWithBatchRequest(batchedInputs, batchedOutputs);
 }
 
 AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap& networkInputs,
@@ -83,7 +90,9 @@ AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap& networkInputs,
       _myBatchedRequestWrapper(workerRequest),
       _batchId(batch_id),
       _batchSize(num_batch) {
-    ShareBlobsWithBatchRequest(batchedInputs, batchedOutputs);
+    // with the packing, the blobs are set by the user and copied to/from the blobs of the batched request
+    if (!workerRequest._packRequests)
+        ShareBlobsWithBatchRequest(batchedInputs, batchedOutputs);
 }
 
 void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::string>& batchedInputs,
@@ -386,19 +395,29 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
         explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto& workerInferRequest = _this->_inferRequest->_myBatchedRequestWrapper;
+            _this->_inferRequest->_startTime = AdaptiveBatchController::Clock::now();
+            if (workerInferRequest._controller)
+                workerInferRequest._controller->OnArrival();
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
-            if (sz == workerInferRequest._batchSize) {
+            // the packed requests are executed as soon as the (adaptive) batch size is collected
+            const int batchSize = workerInferRequest._packRequests && workerInferRequest._controller
+                                      ? workerInferRequest._controller->GetBatchSize()
+                                      : workerInferRequest._batchSize;
+            if (sz == batchSize) {
                 workerInferRequest._cond.notify_one();
             }
         };
         AutoBatchAsyncInferRequest* _this = nullptr;
     };
     _pipeline = {{/*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+                      auto controller = this->_inferRequest->_myBatchedRequestWrapper._controller;
+                      if (controller)
+                          controller->OnCompleted(AdaptiveBatchController::ElapsedMs(this->_inferRequest->_startTime));
                       if (this->_inferRequest->_exceptionPtr)  // if the exception happened in the batch1 fallback
                           std::rethrow_exception(this->_inferRequest->_exceptionPtr);
                       auto& batchReq = this->_inferRequest->_myBatchedRequestWrapper;
@@ -414,7 +433,8 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts()
     const {
     CheckState();
-    if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+    if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed ||
+        AutoBatchInferRequest::eExecutionFlavor::PACKED_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
@@ -435,19 +455,27 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    bool packRequests)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
       _config{config},
       _batchedInputs(batchedInputs),
-      _batchedOutputs(batchedOutputs) {
+      _batchedOutputs(batchedOutputs),
+      _packRequests(packRequests) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     _device = networkDevice;
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
-    _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    _timeOut = ParseTimeoutValue(time_out->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    unsigned int latencyTarget = 0;
+    auto latency_target = config.find(PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET);
+    if (latency_target != config.end())
+        latencyTarget = ParseTimeoutValue(latency_target->second.as<std::string>(),
+                                          PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET);
+    _controller.reset(new AdaptiveBatchController(_device.batchForDevice, _packRequests, _timeOut, latencyTarget));
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -458,10 +486,10 @@ AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
     _workerRequests.clear();
 }
 
-unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s) {
+unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s, const std::string& name) {
     auto val = std::stoi(s);
     if (val < 0)
-        IE_THROW(ParameterMismatch) << "Value for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " should be unsigned int";
+        IE_THROW(ParameterMismatch) << "Value for the " << name << " should be unsigned int";
     return val;
 }
 
@@ -506,11 +534,17 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         auto workerRequestPtr = _workerRequests.back().get();
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
+        workerRequestPtr->_packRequests = _packRequests;
+        workerRequestPtr->_controller = _controller.get();
+        _controller->SetNumWorkers(_workerRequests.size());
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                workerRequestPtr->_controller->OnExecuted(
+                    workerRequestPtr->_batchSize,
+                    AdaptiveBatchController::ElapsedMs(workerRequestPtr->_startTime));
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -525,10 +559,23 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    int timeOut = _controller->GetTimeout();
+                    if (workerRequestPtr->_packRequests) {
+                        // the requests that arrived while the previous pack was executed are already waiting,
+                        // so the time to collect the rest of the batch is shortened proportionally to the load
+                        const int batchSize = _controller->GetBatchSize();
+                        const int pending = std::min(static_cast<int>(workerRequestPtr->_tasks.size()), batchSize);
+                        timeOut = timeOut * (batchSize - pending) / batchSize;
+                    }
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(timeOut));
                 }
                 if (_terminate) {
                     break;
+                } else if (workerRequestPtr->_packRequests) {
+                    const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
+                    // no batch1 fallback: whatever has been collected by the time-out is executed as a (smaller) pack
+                    if (sz >= _controller->GetBatchSize() || ((status == std::cv_status::timeout) && sz))
+                        ExecutePackedRequests(*workerRequestPtr, sz);
                 } else {
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
@@ -542,6 +589,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_startTime = AdaptiveBatchController::Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
@@ -550,12 +598,14 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
+                        const auto start = AdaptiveBatchController::Clock::now();
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, sz, start, &arrived, &all_completed, this](std::exception_ptr p) {
                                     if (p)
                                         t.first->_inferRequest->_exceptionPtr = p;
+                                    _controller->OnExecuted(1, AdaptiveBatchController::ElapsedMs(start));
                                     t.second();
                                     if (sz == ++arrived)
                                         all_completed.set_value();
@@ -575,6 +625,103 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     return {*_workerRequests.back(), static_cast<int>(batch_id)};
 }
 
+void AutoBatchExecutableNetwork::ExecutePackedRequests(WorkerInferRequest& workerRequest, int numRequests) {
+    using Task = std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>;
+    // only the requests with the same input shapes (except the batch) can be packed together
+    std::map<std::vector<SizeVector>, std::vector<Task>> packs;
+    for (int n = 0; n < numRequests; n++) {
+        Task t;
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+        auto& request = t.first->_inferRequest;
+        request->_exceptionPtr = nullptr;
+        request->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::PACKED_EXECUTED;
+        try {
+            std::vector<SizeVector> shapes;
+            for (const auto& name : _batchedInputs) {
+                auto blob = request->GetBlob(name);
+                if (!blob)
+                    IE_THROW(NotAllocated) << "Auto-batching cannot pack the request without the input " << name;
+                auto dims = blob->getTensorDesc().getDims();
+                dims[0] = 0;
+                shapes.push_back(dims);
+            }
+            packs[shapes].push_back(std::move(t));
+        } catch (...) {
+            request->_exceptionPtr = std::current_exception();
+            t.second();
+        }
+    }
+
+    auto& batchedRequest = workerRequest._inferRequestBatched;
+    for (auto& pack : packs) {
+        auto& tasks = pack.second;
+        try {
+            // the requests are concatenated by the 0th dim (no padding), the offsets are the cumulative batches
+            std::vector<size_t> batches;
+            for (const auto& name : _batchedInputs) {
+                auto desc = tasks.front().first->_inferRequest->GetBlob(name)->getTensorDesc();
+                SizeVector dims = desc.getDims();
+                dims[0] = 0;
+                batches.clear();
+                for (const auto& t : tasks) {
+                    batches.push_back(t.first->_inferRequest->GetBlob(name)->getTensorDesc().getDims()[0]);
+                    dims[0] += batches.back();
+                }
+                auto& packed = workerRequest._packedBlobs[name];
+                if (!packed || packed->getTensorDesc().getDims() != dims) {
+                    packed = make_blob_with_precision({desc.getPrecision(), dims, desc.getLayout()});
+                    packed->allocate();
+                }
+                auto dst = packed->buffer().as<uint8_t*>();
+                for (const auto& t : tasks) {
+                    auto src = t.first->_inferRequest->GetBlob(name);
+                    memcpy(dst, src->cbuffer().as<const uint8_t*>(), src->byteSize());
+                    dst += src->byteSize();
+                }
+                batchedRequest->SetBlob(name, packed);
+            }
+            const auto start = AdaptiveBatchController::Clock::now();
+            batchedRequest->Infer();
+            _controller->OnExecuted(static_cast<int>(tasks.size()), AdaptiveBatchController::ElapsedMs(start));
+            const size_t total = std::accumulate(batches.begin(), batches.end(), static_cast<size_t>(0));
+            for (const auto& name : _batchedOutputs) {
+                auto packed = batchedRequest->GetBlob(name);
+                if (!packed)
+                    IE_THROW(NotAllocated) << "Auto-batching cannot unpack the missing output " << name;
+                auto desc = packed->getTensorDesc();
+                SizeVector dims = desc.getDims();
+                if (dims[0] != total)
+                    IE_THROW() << "Auto-batching cannot unpack the output " << name << " with the batch " << dims[0]
+                               << " while " << total << " was packed";
+                // the requests with the empty batch get the empty outputs
+                const size_t bytesPerBatch = total ? packed->byteSize() / total : 0;
+                auto src = packed->cbuffer().as<const uint8_t*>();
+                for (size_t i = 0; i < tasks.size(); i++) {
+                    auto& request = tasks[i].first->_inferRequest;
+                    dims[0] = batches[i];
+                    Blob::Ptr output;
+                    try {
+                        output = request->GetBlob(name);
+                    } catch (const InferenceEngine::Exception&) {
+                    }
+                    if (!output || output->getTensorDesc().getDims() != dims) {
+                        output = make_blob_with_precision({desc.getPrecision(), dims, desc.getLayout()});
+                        output->allocate();
+                        request->SetBlob(name, output);
+                    }
+                    memcpy(output->buffer().as<uint8_t*>(), src, bytesPerBatch * batches[i]);
+                    src += bytesPerBatch * batches[i];
+                }
+            }
+        } catch (...) {
+            for (auto& t : tasks)
+                t.first->_inferRequest->_exceptionPtr = std::current_exception();
+        }
+        for (auto& t : tasks)
+            t.second();
+    }
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
     if (!_network) {
         auto res = _networkWithoutBatch->CreateInferRequest();
@@ -602,12 +749,23 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 }
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& user_config) {
-    auto timeout = user_config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == user_config.end() || user_config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
-        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
+    const auto& latency_key = PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET;
+    auto is_unsupported = [&](const std::pair<std::string, InferenceEngine::Parameter>& c) {
+        return c.first != CONFIG_KEY(AUTO_BATCH_TIMEOUT) && c.first != latency_key;
+    };
+    if (user_config.empty() || std::any_of(user_config.begin(), user_config.end(), is_unsupported)) {
+        IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and the " << latency_key;
+    }
+    for (const auto& c : user_config) {
+        const auto value = ParseTimeoutValue(c.second.as<std::string>(), c.first);
+        if (c.first == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+            _timeOut = value;
+            _controller->SetTimeout(value);
+        } else {
+            _controller->SetLatencyTarget(value);
+        }
+        _config[c.first] = c.second;
     }
 }
 
@@ -649,12 +807,25 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
                               METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                              ov::execution_devices.name()});
+                              ov::execution_devices.name(),
+                              PluginConfigInternalParams::KEY_AUTO_BATCH_CURRENT_TIMEOUT,
+                              PluginConfigInternalParams::KEY_AUTO_BATCH_CURRENT_BATCH_SIZE,
+                              PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_HISTOGRAM,
+                              PluginConfigInternalParams::KEY_AUTO_BATCH_ARRIVAL_HISTOGRAM});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        // only timeout and latency target can be changed on the fly
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET});
     } else if (name == ov::execution_devices) {
         return _networkWithoutBatch->GetMetric(name);
+    } else if (name == PluginConfigInternalParams::KEY_AUTO_BATCH_CURRENT_TIMEOUT) {
+        return _controller->GetTimeout();
+    } else if (name == PluginConfigInternalParams::KEY_AUTO_BATCH_CURRENT_BATCH_SIZE) {
+        return static_cast<unsigned int>(_controller->GetBatchSize());
+    } else if (name == PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_HISTOGRAM) {
+        return _controller->GetLatencyHistogram();
+    } else if (name == PluginConfigInternalParams::KEY_AUTO_BATCH_ARRIVAL_HISTOGRAM) {
+        return _controller->GetArrivalHistogram();
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -747,15 +918,18 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) || name == ov::device::priorities.name()) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) ||
+                   name == PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception&) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
+        } else if (name == PluginConfigInternalParams::KEY_AUTO_BATCH_PACK_DYNAMIC_REQUESTS) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for " << name << " got " << val;
         }
     }
 }
@@ -773,6 +947,8 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[PluginConfigInternalParams::KEY_AUTO_BATCH_LATENCY_TARGET] = "0";  // no target by default
+    _config[PluginConfigInternalParams::KEY_AUTO_BATCH_PACK_DYNAMIC_REQUESTS] = CONFIG_VALUE(NO);
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -823,6 +999,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
 
     std::set<std::string> batched_inputs;
     std::set<std::string> batched_outputs;
+    bool pack_requests = false;
     // check that the auto-batching is applicable in general
     try {
         // if applicable, the Auto-Batching is implicitly enabled via the performance hints
@@ -842,10 +1019,43 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
         // do not reshape/re-batch originally batched networks and when there are no inputs with the N* layouts
         // input(s) should have the batch dim as the first dim (current limitation of the auto-batching impl)
         const auto& params = function->get_parameters();
-        for (size_t input_id = 0; input_id < params.size(); input_id++) {
+        const auto& results = function->get_results();
+        if (function->is_dynamic()) {
+            // the dynamic networks are not re-batched, instead the requests (of the same shapes) are packed
+            // along the 0th dim, which should be dynamic for every input/output of the network
+            if (!metaDevice.batchForDevice)
+                IE_THROW(NotImplemented) << "Auto-batching of dynamic networks requires the explicit batch size!";
+            // the 0th dim may be e.g. a sequence length or a boxes count, so it is treated as the batch only if
+            // the layout tells so or the user explicitly allowed the packing
+            const auto pack_dynamic = fullConfig.find(PluginConfigInternalParams::KEY_AUTO_BATCH_PACK_DYNAMIC_REQUESTS);
+            const bool packing_allowed = pack_dynamic != fullConfig.end() && pack_dynamic->second == CONFIG_VALUE(YES);
+            auto is_packable = [&](const ov::PartialShape& shape, const ov::Layout& layout) {
+                const bool batch_layout = ov::layout::has_batch(layout) && ov::layout::batch_idx(layout) == 0;
+                return shape.rank().is_static() && shape.size() && shape[0].is_dynamic() &&
+                       (batch_layout || packing_allowed);
+            };
+            for (const auto& param : params) {
+                if (!is_packable(param->get_partial_shape(), param->get_layout()))
+                    IE_THROW(NotImplemented)
+                        << "Auto-batching supports only dynamic networks with the dynamic batch ('N') 0th dim of the "
+                           "inputs!";
+                batched_inputs.insert(ov::op::util::get_ie_output_name(param->output(0)));
+            }
+            for (const auto& result : results) {
+                if (!is_packable(result->get_output_partial_shape(0), result->get_layout()))
+                    IE_THROW(NotImplemented)
+                        << "Auto-batching supports only dynamic networks with the dynamic batch ('N') 0th dim of the "
+                           "outputs!";
+                const auto& node = result->input_value(0);
+                batched_outputs.insert(
+                    ov::op::util::get_ie_output_name(ov::Output<const ov::Node>(node.get_node(), node.get_index())));
+            }
+            pack_requests = true;
+        }
+        for (size_t input_id = 0; input_id < params.size() && !pack_requests; input_id++) {
             const auto& input = params[input_id];
             const auto& shape = input->get_partial_shape();
-            // currently no plugin support batched execution for dynamic networks
+            // the dynamic networks with no dynamic batch cannot be executed batched
             if (shape.is_dynamic())
                 IE_THROW(NotImplemented) << "Auto-batching does not support dynamic networks!";
             // check the batch dim: either 0th (and the original batch size of 1) or none
@@ -863,8 +1073,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
                             << "Auto-batching operates only networks with inputs/outputs batched by 0th dimension";
             }
         }
-        const auto& results = function->get_results();
-        for (size_t output_id = 0; output_id < results.size(); output_id++) {
+        for (size_t output_id = 0; output_id < results.size() && !pack_requests; output_id++) {
             const auto& output = results[output_id];
             const auto& shape = output->get_output_partial_shape(0);
             if (shape.is_dynamic())
@@ -889,6 +1098,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
                 << "Auto-batching supports only networks with inputs/outputs featuring batched dim!";
     } catch (const InferenceEngine::Exception&) {
         metaDevice.batchForDevice = 1;
+        pack_requests = false;
     }
 
     if (!metaDevice.batchForDevice) {
@@ -945,7 +1155,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
     }
 
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
-    if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
+    if (metaDevice.batchForDevice > 1 && pack_requests) {
+        // the packed requests are executed with the same (dynamic) network
+        executableNetworkWithBatch = executableNetworkWithoutBatch;
+    } else if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
             CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
             ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
@@ -964,7 +1177,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        pack_requests && metaDevice.batchForDevice > 1);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
@@ -7,12 +7,14 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "batch_controller.hpp"
 #include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
@@ -47,6 +49,11 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // dynamic networks: the requests are packed (concatenated by the 0th dim) into the blobs of the batched request
+        bool _packRequests = false;
+        std::map<std::string, InferenceEngine::Blob::Ptr> _packedBlobs;
+        AdaptiveBatchController* _controller = nullptr;
+        AdaptiveBatchController::Clock::time_point _startTime;
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -55,7 +62,8 @@ public:
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        bool packRequests = false);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -72,13 +80,14 @@ public:
     virtual ~AutoBatchExecutableNetwork();
 
 protected:
-    static unsigned int ParseTimeoutValue(const std::string&);
+    static unsigned int ParseTimeoutValue(const std::string& value, const std::string& name);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    void ExecutePackedRequests(WorkerInferRequest& workerRequest, int numRequests);
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
     std::mutex _workerRequestsMutex;
 
@@ -86,9 +95,12 @@ protected:
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    std::unique_ptr<AdaptiveBatchController> _controller;
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
+    // the network is dynamic (by the 0th dim), so the requests of the same shapes are packed into a single inference
+    const bool _packRequests;
 };
 
 class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -118,8 +130,10 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PACKED_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    AdaptiveBatchController::Clock::time_point _startTime;
 
 protected:
     void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
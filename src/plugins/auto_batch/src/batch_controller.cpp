@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batch_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AutoBatchPlugin {
+
+namespace {
+// weight of the new sample in the moving averages
+constexpr double smoothing = 0.1;
+// the shortest time to collect the batch, to avoid spinning of the worker thread
+constexpr unsigned int minTimeout = 1;  // in ms
+}  // namespace
+
+constexpr size_t AdaptiveBatchController::histogramSize;
+
+AdaptiveBatchController::AdaptiveBatchController(int maxBatchSize,
+                                                 bool variableBatchSize,
+                                                 unsigned int timeOut,
+                                                 unsigned int latencyTarget)
+    : _maxBatchSize(std::max(maxBatchSize, 1)),
+      _variableBatchSize(variableBatchSize),
+      _timeOut(timeOut),
+      _latencyTarget(latencyTarget),
+      _latencies(_maxBatchSize + 1),
+      _latencyHistogram(histogramSize, 0),
+      _arrivalHistogram(histogramSize, 0),
+      _chosenTimeout(timeOut),
+      _chosenBatchSize(_maxBatchSize) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Update();
+}
+
+void AdaptiveBatchController::SetTimeout(unsigned int timeOut) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _timeOut = timeOut;
+    Update();
+}
+
+void AdaptiveBatchController::SetLatencyTarget(unsigned int latencyTarget) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _latencyTarget = latencyTarget;
+    Update();
+}
+
+void AdaptiveBatchController::SetNumWorkers(size_t numWorkers) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _numWorkers = std::max<size_t>(numWorkers, 1);
+    Update();
+}
+
+double AdaptiveBatchController::ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+size_t AdaptiveBatchController::GetHistogramBucket(double latency) {
+    if (latency < 1.0)
+        return 0;
+    const auto bucket = static_cast<size_t>(std::log2(latency)) + 1;
+    return std::min(bucket, histogramSize - 1);
+}
+
+void AdaptiveBatchController::OnArrival() {
+    const auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_arrived) {
+        const double interval = std::chrono::duration<double, std::milli>(now - _lastArrival).count();
+        _interval = _interval > 0.0 ? (1.0 - smoothing) * _interval + smoothing * interval : interval;
+        _arrivalHistogram[GetHistogramBucket(interval)]++;
+    }
+    _arrived = true;
+    _lastArrival = now;
+    Update();
+}
+
+void AdaptiveBatchController::OnExecuted(int batchSize, double latency) {
+    if (batchSize < 1 || batchSize > _maxBatchSize)
+        return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& stat = _latencies[batchSize];
+    if (stat.mean > 0.0) {
+        stat.deviation = (1.0 - smoothing) * stat.deviation + smoothing * std::fabs(latency - stat.mean);
+        stat.mean = (1.0 - smoothing) * stat.mean + smoothing * latency;
+    } else {
+        stat.mean = latency;
+    }
+    Update();
+}
+
+void AdaptiveBatchController::OnCompleted(double latency) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _latencyHistogram[GetHistogramBucket(latency)]++;
+}
+
+std::vector<uint64_t> AdaptiveBatchController::GetLatencyHistogram() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _latencyHistogram;
+}
+
+std::vector<uint64_t> AdaptiveBatchController::GetArrivalHistogram() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _arrivalHistogram;
+}
+
+double AdaptiveBatchController::EstimateP99Latency(int batchSize) const {
+    // for the normally distributed latency the p99 is about the mean + 3 (mean absolute) deviations
+    auto estimate = [](const LatencyStat& stat) {
+        return stat.mean + 3.0 * stat.deviation;
+    };
+    if (_latencies[batchSize].mean > 0.0)
+        return estimate(_latencies[batchSize]);
+    // the larger batch is not faster, so its latency is the upper bound
+    for (int b = batchSize + 1; b <= _maxBatchSize; b++)
+        if (_latencies[b].mean > 0.0)
+            return estimate(_latencies[b]);
+    // otherwise the latency is (pessimistically) scaled linearly from the smaller batch
+    for (int b = batchSize - 1; b > 0; b--)
+        if (_latencies[b].mean > 0.0)
+            return estimate(_latencies[b]) * batchSize / b;
+    // nothing is measured yet
+    return 0.0;
+}
+
+void AdaptiveBatchController::Update() {
+    if (!_latencyTarget) {
+        _chosenTimeout = _timeOut;
+        _chosenBatchSize = _maxBatchSize;
+        return;
+    }
+    const double target = static_cast<double>(_latencyTarget);
+    // the requests are distributed over the workers, so each worker collects its batch slower
+    const double interval = _interval * _numWorkers;
+    // when the batch is not collected in time, the requests are executed one by one (or as a smaller pack)
+    const double fallbackLatency = _variableBatchSize ? 0.0 : EstimateP99Latency(1);
+    const int minBatchSize = _variableBatchSize ? 1 : _maxBatchSize;
+    for (int batchSize = _maxBatchSize; batchSize >= minBatchSize; batchSize--) {
+        const double execution = std::max(EstimateP99Latency(batchSize), fallbackLatency);
+        const double collection = (batchSize - 1) * interval;
+        if (collection + execution <= target) {
+            const auto budget = static_cast<unsigned int>(target - execution);
+            _chosenTimeout = std::max(minTimeout, std::min(budget, _timeOut));
+            _chosenBatchSize = batchSize;
+            return;
+        }
+    }
+    // the target cannot be met by batching, so there is no point to wait for the rest of the batch
+    _chosenTimeout = minTimeout;
+    _chosenBatchSize = minBatchSize;
+}
+
+}  // namespace AutoBatchPlugin
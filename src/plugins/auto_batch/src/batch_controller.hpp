@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#ifdef AUTOBATCH_UNITTEST
+#    define AutoBatchPlugin MockAutoBatchPlugin
+#endif
+
+namespace AutoBatchPlugin {
+
+// Chooses the time to collect the batch (and the batch size itself, when the requests are packed so any batch
+// up to the max is possible) that keep the estimated p99 latency of the requests within the user's target.
+// The estimation is based on the observed arrival rate of the requests and the device latency per batch size.
+// With no latency target, the user's timeout and the max batch size are used as is.
+class AdaptiveBatchController {
+public:
+    using Clock = std::chrono::steady_clock;
+    // the histograms buckets are [0, 1), [1, 2), [2, 4), [4, 8) ... ms, the last bucket collects the rest
+    static constexpr size_t histogramSize = 16;
+
+    AdaptiveBatchController(int maxBatchSize, bool variableBatchSize, unsigned int timeOut, unsigned int latencyTarget);
+
+    void SetTimeout(unsigned int timeOut);
+    void SetLatencyTarget(unsigned int latencyTarget);
+    void SetNumWorkers(size_t numWorkers);
+
+    // a request is submitted to the worker
+    void OnArrival();
+    // the device executed the batch of the given size with the given latency (in ms)
+    void OnExecuted(int batchSize, double latency);
+    // the request is completed with the given end-to-end latency (in ms)
+    void OnCompleted(double latency);
+
+    unsigned int GetTimeout() const {
+        return _chosenTimeout;
+    }
+    int GetBatchSize() const {
+        return _chosenBatchSize;
+    }
+    std::vector<uint64_t> GetLatencyHistogram() const;
+    std::vector<uint64_t> GetArrivalHistogram() const;
+
+    static double ElapsedMs(Clock::time_point start);
+
+protected:
+    struct LatencyStat {
+        double mean = 0.0;       // zero for the batch sizes that were not executed yet
+        double deviation = 0.0;  // mean absolute deviation
+    };
+
+    // both methods are called under the _mutex
+    void Update();
+    double EstimateP99Latency(int batchSize) const;
+
+    static size_t GetHistogramBucket(double latency);
+
+    const int _maxBatchSize;
+    const bool _variableBatchSize;
+    unsigned int _timeOut;
+    unsigned int _latencyTarget;
+    size_t _numWorkers = 1;
+
+    mutable std::mutex _mutex;
+    bool _arrived = false;
+    Clock::time_point _lastArrival;
+    double _interval = 0.0;  // moving average of the time between the requests, in ms
+    std::vector<LatencyStat> _latencies;
+    std::vector<uint64_t> _latencyHistogram;
+    std::vector<uint64_t> _arrivalHistogram;
+
+    std::atomic_uint _chosenTimeout;
+    std::atomic_int _chosenBatchSize;
+};
+
+}  // namespace AutoBatchPlugin
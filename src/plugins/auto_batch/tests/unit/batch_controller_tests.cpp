@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "batch_controller.hpp"
+
+using namespace MockAutoBatchPlugin;
+
+TEST(AdaptiveBatchControllerTest, NoLatencyTarget) {
+    AdaptiveBatchController controller(8, true, 200, 0);
+    controller.OnExecuted(8, 500.0);
+    EXPECT_EQ(200, controller.GetTimeout());
+    EXPECT_EQ(8, controller.GetBatchSize());
+
+    controller.SetTimeout(100);
+    EXPECT_EQ(100, controller.GetTimeout());
+}
+
+TEST(AdaptiveBatchControllerTest, VariableBatchMeetsLatencyTarget) {
+    AdaptiveBatchController controller(8, true, 200, 50);
+    // nothing is measured yet, so the full batch is expected to meet the target
+    EXPECT_EQ(8, controller.GetBatchSize());
+
+    controller.OnExecuted(8, 40.0);
+    EXPECT_EQ(8, controller.GetBatchSize());
+    EXPECT_EQ(10, controller.GetTimeout());
+
+    // the full batch is too slow for the target, while the batch of 2 fits
+    AdaptiveBatchController slow(8, true, 200, 50);
+    slow.OnExecuted(8, 80.0);
+    slow.OnExecuted(2, 20.0);
+    EXPECT_EQ(2, slow.GetBatchSize());
+    EXPECT_EQ(30, slow.GetTimeout());
+
+    // the timeout never exceeds the user's value
+    slow.SetTimeout(5);
+    EXPECT_EQ(5, slow.GetTimeout());
+}
+
+TEST(AdaptiveBatchControllerTest, FixedBatchMissesLatencyTarget) {
+    AdaptiveBatchController controller(8, false, 200, 50);
+    controller.OnExecuted(8, 80.0);
+    // no point to wait for the batch that cannot meet the target anyway
+    EXPECT_EQ(8, controller.GetBatchSize());
+    EXPECT_EQ(1, controller.GetTimeout());
+
+    controller.SetLatencyTarget(0);
+    EXPECT_EQ(200, controller.GetTimeout());
+}
+
+TEST(AdaptiveBatchControllerTest, LatencyHistogram) {
+    AdaptiveBatchController controller(4, false, 200, 0);
+    controller.OnCompleted(0.5);
+    controller.OnCompleted(3.0);
+    controller.OnCompleted(3.5);
+    controller.OnCompleted(1e9);
+    const auto histogram = controller.GetLatencyHistogram();
+    ASSERT_EQ(AdaptiveBatchController::histogramSize, histogram.size());
+    EXPECT_EQ(1, histogram[0]);
+    EXPECT_EQ(2, histogram[2]);
+    EXPECT_EQ(1, histogram.back());
+    EXPECT_EQ(0, controller.GetArrivalHistogram()[0]);
+}
@@ -7,6 +7,7 @@
 
 #include <dimension_tracker.hpp>
 
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "mock_auto_batch_plugin.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
@@ -168,6 +169,60 @@ TEST_P(PluginLoadNetworkTest, PluginLoadBatchedNetworkTestCase) {
     EXPECT_EQ(1, std::atoi(res.as<std::string>().c_str()));
 }
 
+TEST_P(PluginLoadNetworkTest, PluginLoadDynamicNetworkTestCase) {
+    std::map<std::string, std::string> params;
+    std::map<std::string, std::string> configs;
+    int batch_size;
+    std::tie(params, configs, batch_size) = this->GetParam();
+
+    ON_CALL(*core, GetConfig(_, StrEq("PERFORMANCE_HINT"))).WillByDefault(Return(params["PERFORMANCE_HINT"]));
+    ON_CALL(*core, GetMetric(_, StrEq("OPTIMAL_BATCH_SIZE"), _)).WillByDefault(Return(params["OPTIMAL_BATCH_SIZE"]));
+    ON_CALL(*core, GetConfig(_, StrEq("PERFORMANCE_HINT_NUM_REQUESTS")))
+        .WillByDefault(Return(params["PERFORMANCE_HINT_NUM_REQUESTS"]));
+
+    ON_CALL(*core, GetMetric(_, StrEq("GPU_MEMORY_STATISTICS"), _))
+        .WillByDefault([this, &params](const std::string& device, const std::string& key, const ov::AnyMap& options) {
+            static int flag = 0;
+            ov::Any value = params[key];
+            uint64_t data = flag * value.as<uint64_t>();
+            std::map<std::string, uint64_t> ret = {{"xyz", data}};
+            flag = flag ? 0 : 1;
+            return ret;
+        });
+
+    ON_CALL(*core, GetMetric(_, StrEq("GPU_DEVICE_TOTAL_MEM_SIZE"), _))
+        .WillByDefault(Return(params["GPU_DEVICE_TOTAL_MEM_SIZE"]));
+
+    ON_CALL(*cpuMockIExecNet, GetConfig(StrEq("PERFORMANCE_HINT_NUM_REQUESTS"))).WillByDefault(Return("0"));
+    ON_CALL(*cpuMockIExecNet, GetMetric(StrEq("OPTIMAL_NUMBER_OF_INFER_REQUESTS"))).WillByDefault(Return("1"));
+
+    // the requests of the dynamic network are packed only when the batch size is set explicitly
+    // and the 0th dim is known to be the batch: either from the layout or from the explicit opt-in
+    const bool explicit_batch = configs["AUTO_BATCH_DEVICE_CONFIG"].find('(') != std::string::npos;
+    auto load_and_get_requests = [&](bool batch_layout, const std::string& pack_dynamic) {
+        auto graph = ngraph::builder::subgraph::makeMultiSingleConv();
+        graph->reshape(ov::PartialShape{-1, 3, 24, 24});
+        if (batch_layout) {
+            for (const auto& param : graph->get_parameters())
+                param->set_layout("NCHW");
+            for (const auto& result : graph->get_results())
+                result->set_layout("NCHW");
+        }
+        auto net = CNNNetwork(graph);
+        auto config = configs;
+        config[PluginConfigInternalParams::KEY_AUTO_BATCH_PACK_DYNAMIC_REQUESTS] = pack_dynamic;
+        InferenceEngine::IExecutableNetworkInternal::Ptr execNet;
+        EXPECT_NO_THROW(execNet = plugin->LoadNetworkImpl(net, {}, config));
+        InferenceEngine::Parameter res;
+        EXPECT_NO_THROW(res = execNet->GetMetric("OPTIMAL_NUMBER_OF_INFER_REQUESTS"));
+        return std::atoi(res.as<std::string>().c_str());
+    };
+    EXPECT_EQ(explicit_batch ? batch_size : 1, load_and_get_requests(true, "NO"));
+    EXPECT_EQ(explicit_batch ? batch_size : 1, load_and_get_requests(false, "YES"));
+    // the 0th dim may be e.g. a sequence length, so such networks are not packed
+    EXPECT_EQ(1, load_and_get_requests(false, "NO"));
+}
+
 TEST_P(PluginLoadNetworkTest, PluginLoadNetworkGetMetricTestCase) {
     std::map<std::string, std::string> params;
     std::map<std::string, std::string> configs;
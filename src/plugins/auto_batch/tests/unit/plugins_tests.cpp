@@ -323,7 +323,9 @@ TEST_P(PluginMetricTest, GetPluginMetricTest) {
 }
 
 const char supported_metric[] = "SUPPORTED_METRICS FULL_DEVICE_NAME SUPPORTED_CONFIG_KEYS";
-const char supported_config_keys[] = "AUTO_BATCH_DEVICE_CONFIG MULTI_DEVICE_PRIORITIES AUTO_BATCH_TIMEOUT CACHE_DIR";
+const char supported_config_keys[] =
+    "AUTO_BATCH_DEVICE_CONFIG MULTI_DEVICE_PRIORITIES AUTO_BATCH_TIMEOUT CACHE_DIR AUTO_BATCH_LATENCY_TARGET "
+    "AUTO_BATCH_PACK_DYNAMIC_REQUESTS";
 
 const std::vector<BatchDeviceConfigParams> batchDeviceTestConfigs = {
     BatchDeviceConfigParams{"CPU(4)", "CPU", 4, false},
@@ -365,6 +367,8 @@ const std::vector<SetGetConfigParams> testSetGetConfigParams = {
     SetGetConfigParams{{{"AUTO_BATCH_TIMEOUT", "200"}, {"AUTO_BATCH_DEVICE_CONFIG", "CPU(4)"}, {"CACHE_DIR", "./xyz"}},
                        {},
                        false},
+    SetGetConfigParams{{{"AUTO_BATCH_PACK_DYNAMIC_REQUESTS", "YES"}}, {}, false},
+    SetGetConfigParams{{{"AUTO_BATCH_PACK_DYNAMIC_REQUESTS", "200"}}, {}, true},
     SetGetConfigParams{{{"XYZ", "200"}}, {}, true},
     SetGetConfigParams{{{"XYZ", "200"}, {"AUTO_BATCH_DEVICE_CONFIG", "CPU(4)"}, {"CACHE_DIR", "./xyz"}}, {}, true},
     // Get Config
@@ -375,6 +379,7 @@ const std::vector<SetGetConfigParams> testSetGetConfigParams = {
     SetGetConfigParams{{{"AUTO_BATCH_TIMEOUT", "200"}}, "AUTO_BATCH_TIMEOUT", false},
     SetGetConfigParams{{{"AUTO_BATCH_DEVICE_CONFIG", "CPU(4)"}}, "AUTO_BATCH_DEVICE_CONFIG", false},
     SetGetConfigParams{{{"CACHE_DIR", "./abc"}}, "CACHE_DIR", false},
+    SetGetConfigParams{{{"AUTO_BATCH_PACK_DYNAMIC_REQUESTS", "YES"}}, "AUTO_BATCH_PACK_DYNAMIC_REQUESTS", false},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +16,7 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache is thread safe, so it may be shared between the graphs of several streams.
  */
 
 class MultiCache {
@@ -59,6 +60,7 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    mutable std::mutex _mutex;
 };
 
 template<typename T>
@@ -71,6 +73,7 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -214,6 +214,63 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING == key) {
+            if (val == PluginConfigParams::YES)
+                rtCacheSharing = true;
+            else if (val == PluginConfigParams::NO)
+                rtCacheSharing = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_NODES_EXECUTION == key) {
+            if (val == PluginConfigParams::YES)
+                parallelNodesExecution = true;
+            else if (val == PluginConfigParams::NO)
+                parallelNodesExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_NODES_EXECUTION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_COMPILATION == key) {
+            if (val == PluginConfigParams::YES)
+                parallelGraphCompilation = true;
+            else if (val == PluginConfigParams::NO)
+                parallelGraphCompilation = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_COMPILATION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_CAPACITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            shapesCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION == key) {
+            if (val == PluginConfigInternalParams::ALWAYS)
+                weightsReplication = WeightsReplication::Always;
+            else if (val == PluginConfigInternalParams::NEVER)
+                weightsReplication = WeightsReplication::Never;
+            else if (val == PluginConfigInternalParams::BUDGET)
+                weightsReplication = WeightsReplication::Budget;
+            else if (val == PluginConfigInternalParams::INTERLEAVE)
+                weightsReplication = WeightsReplication::Interleave;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION
+                           << ". Expected values: ALWAYS/NEVER/BUDGET/INTERLEAVE";
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION_BUDGET == key) {
+            try {
+                const auto budget = std::stoll(val);
+                if (budget < 0)
+                    throw std::out_of_range(val);
+                weightsReplicationBudget = static_cast<size_t>(budget);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION_BUDGET
+                           << ". Expected only non-negative integer numbers";
+            }
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -40,6 +40,13 @@ struct Config {
         Disable,
     };
 
+    enum WeightsReplication {
+        Always,
+        Never,
+        Budget,
+        Interleave,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -49,6 +56,12 @@ struct Config {
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
     size_t rtCacheCapacity = 5000ul;
+    bool rtCacheSharing = false;
+    bool parallelNodesExecution = false;
+    bool parallelGraphCompilation = true;
+    size_t shapesCacheCapacity = 100ul;
+    WeightsReplication weightsReplication = WeightsReplication::Always;
+    size_t weightsReplicationBudget = 0ul;  // in bytes
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
     bool useCpuPinning = true;
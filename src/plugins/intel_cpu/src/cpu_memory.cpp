@@ -17,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/numa_memory.hpp"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -228,6 +229,61 @@ void MemoryMngrWithReuse::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
+void* MemoryMngrWithDeferredAllocation::getRawPtr() const noexcept {
+    return _mngr.getRawPtr();
+}
+
+void MemoryMngrWithDeferredAllocation::setExtBuff(void *ptr, size_t size) {
+    _mngr.setExtBuff(ptr, size);
+}
+
+bool MemoryMngrWithDeferredAllocation::resize(size_t size) {
+    return _allocationDeferred ? false : _mngr.resize(size);
+}
+
+bool MemoryMngrWithDeferredAllocation::hasExtBuffer() const noexcept {
+    return _mngr.hasExtBuffer();
+}
+
+void MemoryMngrWithDeferredAllocation::deferAllocation(bool defer) noexcept {
+    _allocationDeferred = defer;
+}
+
+MemoryMngrOnNumaNodes::~MemoryMngrOnNumaNodes() {
+    release();
+}
+
+void* MemoryMngrOnNumaNodes::getRawPtr() const noexcept {
+    return _data ? _data : _mngr.getRawPtr();
+}
+
+void MemoryMngrOnNumaNodes::setExtBuff(void *ptr, size_t size) {
+    release();
+    _mngr.setExtBuff(ptr, size);
+}
+
+bool MemoryMngrOnNumaNodes::resize(size_t size) {
+    if (_data && size <= _size)
+        return false;
+    void* data = allocateOnNumaNodes(size, _numaNodes);
+    if (!data)
+        return _mngr.resize(size);
+    release();
+    _data = data;
+    _size = size;
+    return true;
+}
+
+bool MemoryMngrOnNumaNodes::hasExtBuffer() const noexcept {
+    return !_data && _mngr.hasExtBuffer();
+}
+
+void MemoryMngrOnNumaNodes::release() {
+    freeOnNumaNodes(_data, _size);
+    _data = nullptr;
+    _size = 0ul;
+}
+
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return _pMemMngr->getRawPtr();
 }
@@ -89,6 +89,46 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief Memory manager of a tensor which is placed in a shared arena by the memory plan of the graph.
+ * While the allocation is deferred, resize doesn't allocate the memory, since the tensor gets its place in the arena
+ * when the sizes of all the tensors are known. Otherwise it behaves as MemoryMngrWithReuse.
+ */
+class MemoryMngrWithDeferredAllocation : public IMemoryMngr {
+public:
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+    void deferAllocation(bool defer) noexcept;
+
+private:
+    MemoryMngrWithReuse _mngr;
+    bool _allocationDeferred = false;
+};
+
+/**
+ * @brief Memory manager whose buffer is allocated with its pages placed on the given NUMA nodes (interleaved over them
+ * if there are several). Falls back to MemoryMngrWithReuse when the platform doesn't support such allocation.
+ */
+class MemoryMngrOnNumaNodes : public IMemoryMngr {
+public:
+    explicit MemoryMngrOnNumaNodes(std::vector<int> numaNodes) : _numaNodes(std::move(numaNodes)) {}
+    ~MemoryMngrOnNumaNodes() override;
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    void release();
+
+    std::vector<int> _numaNodes;
+    void* _data = nullptr;
+    size_t _size = 0ul;
+    MemoryMngrWithReuse _mngr;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
@@ -21,6 +21,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "GroupConvolution", Type::Convolution },
         { "MatMul", Type::MatMul },
         { "FullyConnected", Type::FullyConnected },
+        { "FullyConnectedCompressed", Type::FullyConnectedCompressed },
         { "MaxPool", Type::Pooling },
         { "AvgPool", Type::Pooling },
         { "AdaptiveMaxPool", Type::AdaptivePooling},
@@ -242,6 +243,8 @@ std::string NameFromType(const Type type) {
             return "AdaptivePooling";
         case Type::FullyConnected:
             return "FullyConnected";
+        case Type::FullyConnectedCompressed:
+            return "FullyConnectedCompressed";
         case Type::MatMul:
             return "MatMul";
         case Type::Softmax:
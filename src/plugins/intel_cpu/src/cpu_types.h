@@ -29,6 +29,7 @@ enum class Type {
     Pooling,
     AdaptivePooling,
     FullyConnected,
+    FullyConnectedCompressed,
     Softmax,
     Split,
     Concatenation,
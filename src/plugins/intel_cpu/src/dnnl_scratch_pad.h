@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,15 +17,24 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    bool shared = true;
+    // the primitives of the graph nodes may be created concurrently
+    std::mutex mutex;
 
 public:
-    DnnlScratchPad(dnnl::engine eng) : eng(eng) {
+    // a non shared scratch pad hands out a separate buffer to each node, so that the nodes may be executed concurrently
+    DnnlScratchPad(dnnl::engine eng, bool shared = true) : eng(eng), shared(shared) {
         mgrPtr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
         auto mem = std::make_shared<Memory>(eng);
-        mem->Create(md, mgrPtr);
+        if (shared) {
+            std::lock_guard<std::mutex> lock(mutex);
+            mem->Create(md, mgrPtr);
+        } else {
+            mem->Create(md, std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())));
+        }
         return mem;
     }
 };
@@ -25,6 +25,7 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -80,6 +81,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     _cfg.isNewApi = !isLegacyAPI();
     _mutex = std::make_shared<std::mutex>();
+    _numaNodesWeights.setPlacement(getWeightsPlacement());
 
     // WA for inference dynamic batch cases in new API
     if (_cfg.isNewApi) {
@@ -126,12 +128,30 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    if (_cfg.rtCacheSharing && streams > 1) {
+        _sharedParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
+    }
     if (_cfg.streamExecutorConfig._streams != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
                 return graph.IsReady();
             });
         };
+        const bool weightsBudget = _cfg.weightsReplication == Config::WeightsReplication::Budget && streams > 1;
+        if (_sharedParamsCache || weightsBudget) {
+            // the first graph fills the shared cache, so the rest of the streams reuse its kernels instead of generating them
+            std::vector<Task> firstTask{[this] {
+                ExecNetwork::GetGraph();
+            }};
+            _taskExecutor->runAndWait(firstTask);
+        }
+        if (weightsBudget) {
+            const auto placement = NumaNodesWeights::getBudgetPlacement(_numaNodesWeights.getBytes(),
+                                                                        getAvailableNUMANodes().size(),
+                                                                        _cfg.weightsReplicationBudget);
+            if (placement == NumaNodesWeights::Placement::Replicate)
+                _numaNodesWeights.replicate();
+        }
         do {
             for (auto&& task : tasks) {
                 task = [this] {
@@ -168,6 +188,20 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+NumaNodesWeights::Placement ExecNetwork::getWeightsPlacement() const {
+    switch (_cfg.weightsReplication) {
+    case Config::WeightsReplication::Never:
+        return NumaNodesWeights::Placement::Share;
+    case Config::WeightsReplication::Interleave:
+        return NumaNodesWeights::Placement::Interleave;
+    case Config::WeightsReplication::Budget:
+        // the weights are shared until the first graph is compiled, then its cached (repacked) weights are measured
+        return NumaNodesWeights::Placement::Share;
+    default:
+        return NumaNodesWeights::Placement::Replicate;
+    }
+}
+
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
@@ -192,7 +226,12 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         _mutex,
+                                                         isQuantizedFlag,
+                                                         _sharedParamsCache);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -279,6 +318,18 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_STATISTICS) {
+        std::vector<uint64_t> statistics{0, 0};
+        for (const auto& streamGraph : _graphs) {
+            const auto streamStatistics = streamGraph.getShapesCacheStatistics();
+            statistics[0] += streamStatistics.first;
+            statistics[1] += streamStatistics.second;
+        }
+        return statistics;
+    } else if (name == InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_BYTES_PER_NUMA_NODE) {
+        return _numaNodesWeights.getBytesPerNode();
+    } else if (name == InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_REMOTE_ACCESS_RATIO) {
+        return _numaNodesWeights.getRemoteAccessRatio();
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
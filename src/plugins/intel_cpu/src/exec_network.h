@@ -69,6 +69,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // runtime parameters cache shared by the graphs of all the streams (if enabled in the config)
+    MultiCachePtr                               _sharedParamsCache;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -76,6 +78,8 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    NumaNodesWeights::Placement getWeightsPlacement() const;
+
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <string>
 #include <map>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -35,6 +36,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
@@ -52,6 +54,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #   include <tbb/task_group.h>
 #endif
@@ -405,6 +408,19 @@ void Graph::InitGraph() {
         this->reuse_io_tensors = false;
     }
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the dynamic graphs already overlap shape inference with execution, so only the static ones are run as a DAG
+    parallelExecution = getConfig().parallelNodesExecution && !haveDynNodes;
+#endif
+    // The nodes of the other graphs (e.g. the bodies of the nodes executed concurrently) may run at the same time
+    // in the parallel nodes execution mode, so each graph gets own scratch pad instead of the one of the context.
+    // It is still shared by the nodes of the graph unless they are executed in parallel.
+    if (getConfig().parallelNodesExecution) {
+        auto scratchPad = std::make_shared<DnnlScratchPad>(getEngine(), !parallelExecution);
+        for (auto& node : graphNodes)
+            node->setScratchPad(scratchPad);
+    }
+
     Allocate();
 
     CreatePrimitives();
@@ -416,7 +432,19 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    if (parallelExecution)
+        InitParallelExecution();
+
     ExecuteConstantNodesOnly();
+
+    // The cache is keyed by the input shapes and by the values of the graph inputs read by the shape inference of
+    // the nodes (Reshape pattern, Broadcast target shape, Pad pads, TopK k etc.). The values computed from the shapes
+    // (ShapeOf) are defined by the input shapes, so the producers of the data dependent ports are traced up to
+    // ShapeOf nodes, constants and inputs. The cache can't be used if the values come from the state (ReadValue).
+    // Nodes with output shapes defined in runtime (NonZero etc.) disable the cache on the first inference.
+    if (haveDynNodes && getConfig().shapesCacheCapacity > 0 && InitShapesCacheValueInputs())
+        shapesCache.reset(new LruCache<ShapesCacheKey, ShapesCacheEntry>(getConfig().shapesCacheCapacity));
+
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -430,24 +458,30 @@ void Graph::InitNodes() {
 void Graph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
 
-    for (auto &node : graphNodes) {
+    // the supported descriptors of a node depend only on the node itself, so they are enumerated for all
+    // the nodes at once, while the selection depends on the descriptors selected for the parents
+    ForEachNode(graphNodes, [&](const NodePtr& node) {
         if (node->getType() == Type::Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
             auto *inputNode = dynamic_cast<node::Input *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
-        node->initSupportedPrimitiveDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
-        node->filterSupportedPrimitiveDescriptors();
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.getSupportedDescriptors);
+            DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
+            node->filterSupportedPrimitiveDescriptors();
+        }
 
 #ifdef CPU_DEBUG_CAPS
         const auto& SPDs = node->getSupportedPrimitiveDescriptors();
@@ -464,7 +498,7 @@ void Graph::InitDescriptors() {
                       SPDs[i]);
         }
 #endif
-    }
+    });
 
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
@@ -504,6 +538,86 @@ void Graph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+void Graph::InitParallelExecution() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitParallelExecution");
+    const size_t execNodesNum = executableGraphNodes.size();
+
+    std::unordered_map<const Node*, size_t> execNodesInds;
+    for (size_t i = 0; i < execNodesNum; ++i)
+        execNodesInds[executableGraphNodes[i].get()] = i;
+
+    // The nearest executable ancestors of each node. The non executable nodes (Input, in-place Reshape, etc.)
+    // are transparent, so their dependencies are forwarded to the consumers.
+    std::unordered_map<const Node*, std::set<size_t>> execAncestors;
+    std::vector<std::set<size_t>> predecessors(execNodesNum);
+    for (const auto& node : graphNodes) {  // topological order
+        std::set<size_t> ancestors;
+        for (size_t i = 0; i < node->getParentEdges().size(); ++i) {
+            const auto parent = node->getParentEdgeAt(i)->getParent().get();
+            auto itr = execNodesInds.find(parent);
+            if (itr != execNodesInds.end()) {
+                ancestors.insert(itr->second);
+            } else {
+                const auto& parentAncestors = execAncestors[parent];
+                ancestors.insert(parentAncestors.begin(), parentAncestors.end());
+            }
+        }
+
+        auto itr = execNodesInds.find(node.get());
+        if (itr != execNodesInds.end()) {
+            predecessors[itr->second] = std::move(ancestors);
+        } else {
+            execAncestors[node.get()] = std::move(ancestors);
+        }
+    }
+
+    // the memory which is reused by a producer must have been read by all the consumers of the previous tensor
+    for (const auto& order : memReuseOrder) {
+        auto consumer = execNodesInds.find(order.first);
+        auto producer = execNodesInds.find(order.second);
+        if (consumer != execNodesInds.end() && producer != execNodesInds.end() && consumer->second != producer->second)
+            predecessors[producer->second].insert(consumer->second);
+    }
+
+    // the state nodes communicate through the variable storage, not through the edges, so they keep the serial order
+    size_t lastStateNode = execNodesNum;
+    for (size_t i = 0; i < execNodesNum; ++i) {
+        if (one_of(executableGraphNodes[i]->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+            if (lastStateNode != execNodesNum)
+                predecessors[i].insert(lastStateNode);
+            lastStateNode = i;
+        }
+    }
+
+    execSuccessors.assign(execNodesNum, {});
+    execPredecessorsNum.assign(execNodesNum, 0);
+    for (size_t i = 0; i < execNodesNum; ++i) {
+        execPredecessorsNum[i] = predecessors[i].size();
+        for (auto pred : predecessors[i])
+            execSuccessors[pred].push_back(i);
+    }
+
+    // all the nodes must be reachable from the nodes without predecessors, otherwise some of them are never executed
+    std::vector<size_t> pending(execPredecessorsNum);
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < execNodesNum; ++i) {
+        if (pending[i] == 0)
+            ready.push_back(i);
+    }
+    size_t reachedNodesNum = 0;
+    while (!ready.empty()) {
+        const auto node_indx = ready.back();
+        ready.pop_back();
+        ++reachedNodesNum;
+        for (auto succ_indx : execSuccessors[node_indx]) {
+            if (--pending[succ_indx] == 0)
+                ready.push_back(succ_indx);
+        }
+    }
+    if (reachedNodesNum != execNodesNum)
+        IE_THROW() << "The execution dependencies of the graph " << GetName() << " contain a cycle";
+}
+
 void Graph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
     dnnl::stream stream(getEngine());
@@ -720,14 +834,36 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // In the parallel execution mode the nodes of the same DAG level may run at the same time,
+    // so the tensors lifetime is measured in the levels instead of the serial execution order.
+    // The state nodes are chained in the serial order by InitParallelExecution, so they get the increasing levels
+    // as well. Thus all the dependencies of the nodes, including the memory reuse ones, go from the lower levels
+    // to the higher ones and can't form a cycle.
+    std::vector<int> timeline(graphNodes.size());
+    int lastStateLevel = -1;
+    for (const auto& node : graphNodes) {  // topological order
+        int level = 0;
+        if (parallelExecution) {
+            for (size_t i = 0; i < node->getParentEdges().size(); ++i)
+                level = std::max(level, timeline[node->getParentEdgeAt(i)->getParent()->execIndex] + 1);
+            if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+                level = std::max(level, lastStateLevel + 1);
+                lastStateLevel = level;
+            }
+        } else {
+            level = node->execIndex;
+        }
+        timeline[node->execIndex] = level;
+    }
+
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = timeline[edge->getParent()->execIndex];
+            int e_finish = timeline[edge->getChild()->execIndex];
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -801,6 +937,31 @@ void Graph::AllocateWithReuse() {
         IE_ASSERT(count == 1);
     }
 
+    if (parallelExecution) {
+        // The solver places the tensors with disjoint lifetimes at the same offsets. Since the nodes of
+        // the different levels are not synchronized, the producer of the later tensor has to wait for all
+        // the consumers of the earlier one.
+        for (size_t i = 0; i < definedBoxes.size(); ++i) {
+            const auto& lBox = definedBoxes[i];
+            const int64_t lOffset = staticMemSolver.getOffset(lBox.id);
+            for (size_t j = i + 1; j < definedBoxes.size(); ++j) {
+                const auto& rBox = definedBoxes[j];
+                const int64_t rOffset = staticMemSolver.getOffset(rBox.id);
+                if (lOffset >= rOffset + rBox.size || rOffset >= lOffset + lBox.size)
+                    continue;
+
+                const bool lFirst = lBox.finish != -1 && (rBox.finish == -1 || lBox.start < rBox.start);
+                const auto& earlier = edge_clusters[lFirst ? lBox.id : rBox.id];
+                const auto& later = edge_clusters[lFirst ? rBox.id : lBox.id];
+                for (auto& lastUse : earlier) {
+                    for (auto& firstUse : later) {
+                        memReuseOrder.emplace_back(lastUse->getChild().get(), firstUse->getParent().get());
+                    }
+                }
+            }
+        }
+    }
+
     if (!undefinedBoxes.empty()) {
         if (!syncNodesInds.empty()) {
             //We have to extend the lifespan of thensors that are crossing a sync point border in order to save
@@ -828,9 +989,39 @@ void Graph::AllocateWithReuse() {
 
         MemorySolver::normalizeBoxes(undefinedBoxes);
 
+        // Without the sync points the shapes of all the tensors are known before the execution, so the tensors
+        // can be placed in one arena by the memory plan of the current tensor sizes. The plan is used together with
+        // the shapes cache, which makes the shapes update cheap enough to be done before the allocation. The network
+        // inputs and outputs are kept apart as their memory may be replaced with the user's one.
+        const bool planDynamicMemory = syncNodesInds.empty() && getConfig().shapesCacheCapacity > 0;
+        if (planDynamicMemory) {
+            std::vector<MemorySolver::Box> ioBoxes;
+            for (auto& box : undefinedBoxes) {
+                const auto& cluster = edge_clusters[box.id];
+                const bool isIO = std::any_of(cluster.begin(), cluster.end(), [](const EdgePtr& edge) {
+                    return edge->getParent()->getType() == Type::Input || edge->getChild()->getType() == Type::Output;
+                });
+                if (isIO) {
+                    ioBoxes.push_back(box);
+                    continue;
+                }
+                auto deferredMngr = new MemoryMngrWithDeferredAllocation();
+                auto memMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(deferredMngr));
+                for (auto& edge : cluster) {
+                    if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                        edge->allocate(memMngr);
+                    }
+                }
+                dynamicMemoryBoxes.push_back({box.start, box.finish, cluster, memMngr, deferredMngr});
+            }
+            dynamicMemoryArena.reset(new MemoryMngrWithReuse());
+            dynamicMemoryPlans.reset(new LruCache<DynamicMemoryPlanKey, DynamicMemoryPlanPtr>(getConfig().shapesCacheCapacity));
+            undefinedBoxes.swap(ioBoxes);
+        }
+
         std::vector<std::vector<MemorySolver::Box>> groups; //groups of nonoverlapping boxes
         constexpr bool enableMemReuse = true; // set false to disable mem reuse for debug purposes
-        if (enableMemReuse) {
+        if (enableMemReuse && !undefinedBoxes.empty()) {
             groups.push_back({undefinedBoxes.front()});
             for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
                 const auto& box = undefinedBoxes[i];
@@ -887,10 +1078,43 @@ void Graph::Allocate() {
 
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // the memory is allocated already, so each node creates its primitives (and reorders its weights) on its own
+    ForEachNode(graphNodes, [](const NodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
         DEBUG_LOG(*node);
         node->createPrimitive();
+    });
+}
+
+void Graph::ForEachNode(const std::vector<NodePtr>& nodes, const std::function<void(const NodePtr&)>& func) const {
+    if (!getConfig().parallelGraphCompilation || nodes.size() < 2) {
+        for (const auto& node : nodes)
+            func(node);
+        return;
+    }
+
+    // the nodes with the inner graphs compile them (and execute their constant parts) in the shared graph context,
+    // and the generic nodes run the code of the custom extensions, which is not required to be thread-safe,
+    // so they are processed one by one after the rest
+    auto isSerial = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::TensorIterator, Type::If, Type::Generic);
+    };
+    std::vector<std::exception_ptr> exceptions(nodes.size());
+    parallel_for(nodes.size(), [&](size_t i) {
+        if (isSerial(nodes[i]))
+            return;
+        try {
+            func(nodes[i]);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    });
+    // the error of the first node in the order is reported, so the result doesn't depend on the threads timing
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (exceptions[i])
+            std::rethrow_exception(exceptions[i]);
+        if (isSerial(nodes[i]))
+            func(nodes[i]);
     }
 }
 
@@ -1057,9 +1281,219 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferStaticParallel(InferRequestBase* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const size_t execNodesNum = executableGraphNodes.size();
+    std::vector<std::atomic<size_t>> pendingPredecessors(execNodesNum);
+    for (size_t i = 0; i < execNodesNum; ++i) {
+        pendingPredecessors[i].store(execPredecessorsNum[i]);
+    }
+
+    // the tasks are spawned into the arena of the calling stream, so the independent nodes share its threads
+    tbb::task_group tg;
+    std::function<void(size_t)> executeNode;
+
+    executeNode = [&](size_t node_indx) {
+        const auto& node = executableGraphNodes[node_indx];
+        {
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            dnnl::stream stream(getEngine());
+            ExecuteNode(node, stream);
+        }
+        for (auto succ_indx : execSuccessors[node_indx]) {
+            if (--pendingPredecessors[succ_indx] == 0) {
+                tg.run([=, &executeNode](){ executeNode(succ_indx); });
+            }
+        }
+    };
+
+    for (size_t i = 0; i < execNodesNum; ++i) {
+        if (execPredecessorsNum[i] == 0) {
+            tg.run([=, &executeNode](){ executeNode(i); });
+        }
+    }
+    // rethrows the exception of a failed node, the rest of the nodes are executed otherwise
+    tg.wait();
+#else
+    InferStatic(request);
+#endif
+}
+
+size_t Graph::ShapesCacheKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : inputShapes)
+        seed = get_vector_hash(seed, dims);
+    for (const auto& values : inputValues)
+        seed = get_vector_hash(seed, values);
+    return seed;
+}
+
+bool Graph::InitShapesCacheValueInputs() {
+    shapesCacheValueInputs.clear();
+    std::unordered_set<Node*> visited;
+    std::vector<Node*> producers;
+    for (const auto& node : graphNodes) {
+        if (!node->isDynamicNode() || !node->outputShapeDataDependency())
+            continue;
+        const auto portMask = node->shapeInference->get_port_mask();
+        for (size_t i = 0; i < node->getParentEdges().size(); ++i) {
+            if (portMask & (1 << i))
+                producers.push_back(node->getParentEdgeAt(i)->getParent().get());
+        }
+    }
+
+    while (!producers.empty()) {
+        auto producer = producers.back();
+        producers.pop_back();
+        if (!visited.insert(producer).second || producer->isConstant() || producer->getType() == Type::ShapeOf)
+            continue;
+        if (producer->getType() == Type::Input) {
+            const auto input = std::find_if(inputNodesMap.begin(), inputNodesMap.end(),
+                                            [&](const std::pair<const std::string, NodePtr>& in) {
+                                                return in.second.get() == producer;
+                                            });
+            if (input == inputNodesMap.end())
+                return false;
+            shapesCacheValueInputs.push_back(input->second);
+            continue;
+        }
+        if (producer->getParentEdges().empty())
+            return false;  // the values are the state of the graph (ReadValue) or are generated by the node
+        for (size_t i = 0; i < producer->getParentEdges().size(); ++i)
+            producers.push_back(producer->getParentEdgeAt(i)->getParent().get());
+    }
+    return true;
+}
+
+bool Graph::GetShapesCacheKey(ShapesCacheKey& key) const {
+    // the values of the large inputs (e.g. an image fed to NonZero) would make the key too expensive to compare
+    const size_t maxValuesSize = 1024;
+
+    for (const auto& input : inputNodesMap)
+        key.inputShapes.push_back(input.second->getChildEdgeAt(0)->getMemory().getStaticDims());
+    for (const auto& input : shapesCacheValueInputs) {
+        const auto& memory = input->getChildEdgeAt(0)->getMemory();
+        if (memory.GetSize() > maxValuesSize)
+            return false;
+        const auto data = static_cast<const uint8_t*>(memory.GetData());
+        key.inputValues.emplace_back(data, data + memory.GetSize());
+    }
+    return true;
+}
+
+size_t Graph::DynamicMemoryPlanKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    return get_vector_hash(0, sizes);
+}
+
+void Graph::DeferDynamicMemoryAllocation(bool defer) {
+    for (auto& box : dynamicMemoryBoxes)
+        box.deferredMngr->deferAllocation(defer);
+}
+
+void Graph::PlanDynamicMemory() {
+    const int64_t alignment = 32;  // 32 bytes
+
+    DynamicMemoryPlanKey key;
+    key.sizes.reserve(dynamicMemoryBoxes.size());
+    for (const auto& dynBox : dynamicMemoryBoxes) {
+        int64_t boxSize = 0;
+        for (const auto& edge : dynBox.edges) {
+            const auto& desc = edge->getMemory().getDesc();
+            if (desc.isDefined())
+                boxSize = std::max<int64_t>(boxSize, desc.getCurrentMemSize());
+        }
+        key.sizes.push_back(std::max<int64_t>(div_up(boxSize, alignment), 1));
+    }
+
+    auto plan = dynamicMemoryPlans->get(key);
+    if (!plan) {
+        std::vector<MemorySolver::Box> boxes;
+        for (size_t i = 0; i < dynamicMemoryBoxes.size(); i++)
+            boxes.push_back({dynamicMemoryBoxes[i].start, dynamicMemoryBoxes[i].finish, key.sizes[i], static_cast<int64_t>(i)});
+
+        MemorySolver memSolver(boxes);
+        plan = std::make_shared<DynamicMemoryPlan>();
+        plan->totalSize = memSolver.solve();
+        for (const auto& box : boxes)
+            plan->offsets.push_back(memSolver.getOffset(box.id));
+        dynamicMemoryPlans->put(key, plan);
+    }
+
+    // the same plan in the same arena is already applied
+    if (!dynamicMemoryArena->resize(plan->totalSize * alignment) && appliedMemoryPlan == plan)
+        return;
+
+    auto* arena_ptr = static_cast<int8_t*>(dynamicMemoryArena->getRawPtr());
+    for (size_t i = 0; i < dynamicMemoryBoxes.size(); i++) {
+        dynamicMemoryBoxes[i].memMngr->setExtBuff(arena_ptr + plan->offsets[i] * alignment, key.sizes[i] * alignment);
+    }
+    appliedMemoryPlan = plan;
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
+    ShapesCacheKey shapesKey;
+    ShapesCacheEntry cachedShapes;
+    ShapesCacheEntry inferredShapes;
+    if (shapesCache && GetShapesCacheKey(shapesKey)) {
+        cachedShapes = shapesCache->get(shapesKey);
+        if (cachedShapes) {
+            shapesCacheHits++;
+        } else {
+            shapesCacheMisses++;
+            inferredShapes = std::make_shared<std::vector<std::vector<VectorDims>>>(executableGraphNodes.size());
+        }
+    }
+
+    // is called sequentially for the nodes in the execution order
+    bool shapesUpdated = false;
+    auto updateNodeShapes = [&](size_t node_indx) {
+        if (shapesUpdated)
+            return;
+        const auto& node = executableGraphNodes[node_indx];
+        if (cachedShapes) {
+            node->updateShapes((*cachedShapes)[node_indx]);
+            return;
+        }
+        if (!node->updateShapes()) {
+            // the output shapes are defined in runtime, so the cache is useless for this graph
+            shapesCache.reset();
+            inferredShapes.reset();
+        }
+        if (inferredShapes) {
+            (*inferredShapes)[node_indx] = node->getOutputMemoryShapes();
+        }
+    };
+
+    // The dynamic tensors are placed in the arena before any node prepares its params, so the shapes of all the nodes
+    // are updated first while the allocation is deferred. The planning is skipped once the shapes cache is disabled.
+    if (shapesCache && !dynamicMemoryBoxes.empty()) {
+        DeferDynamicMemoryAllocation(true);
+        try {
+            for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+                if (executableGraphNodes[i]->isDynamicNode())
+                    updateNodeShapes(i);
+            }
+        } catch (...) {
+            DeferDynamicMemoryAllocation(false);
+            throw;
+        }
+        DeferDynamicMemoryAllocation(false);
+        shapesUpdated = true;
+        PlanDynamicMemory();
+    }
+
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
         syncIndsWorkSet.insert(nodeIndx.second);
@@ -1091,7 +1525,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
 
         const auto& node = executableGraphNodes[node_indx];
         if (node->isDynamicNode()) {
-            node->updateShapes();
+            updateNodeShapes(node_indx);
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1125,7 +1559,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                updateNodeShapes(prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1145,6 +1579,9 @@ void Graph::InferDynamic(InferRequestBase* request) {
             ExecuteNode(node, stream);
         }
     }
+
+    if (inferredShapes)
+        shapesCache->put(shapesKey, inferredShapes);
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1168,7 +1605,11 @@ void Graph::Infer(InferRequestBase* request) {
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (parallelExecution) {
+            InferStaticParallel(request);
+        } else {
+            InferStatic(request);
+        }
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
@@ -1517,6 +1958,7 @@ void Graph::EnforceBF16() {
             if (one_of(parent->getType(),
                     Type::Convolution,    // conv nets
                     Type::FullyConnected, // conv / bert nets
+                    Type::FullyConnectedCompressed, // LLM nets
                     Type::RNNCell,        // recurent nets
                     Type::RNNSeq,         // recurent nets
                     Type::MatMul,         // bert nets
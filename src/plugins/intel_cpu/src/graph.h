@@ -11,8 +11,10 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -115,6 +117,13 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Returns the number of hits and misses of the output shapes cache of a dynamic graph
+     */
+    std::pair<uint64_t, uint64_t> getShapesCacheStatistics() const {
+        return {shapesCacheHits.load(), shapesCacheMisses.load()};
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(EdgePtr& edge);
@@ -202,6 +211,16 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        execSuccessors.clear();
+        execPredecessorsNum.clear();
+        memReuseOrder.clear();
+        parallelExecution = false;
+        shapesCache.reset();
+        shapesCacheValueInputs.clear();
+        dynamicMemoryBoxes.clear();
+        dynamicMemoryArena.reset();
+        dynamicMemoryPlans.reset();
+        appliedMemoryPlan.reset();
     }
     Status status { Status::NotReady };
 
@@ -234,8 +253,17 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    // Calls func for the nodes concurrently if CPU_PARALLEL_GRAPH_COMPILATION is enabled. So Node::getSupportedDescriptors,
+    // Node::initSupportedPrimitiveDescriptors, Node::filterSupportedPrimitiveDescriptors and Node::createPrimitive must
+    // modify only the node's own state, while the shared state they use (the runtime parameters cache, the weights
+    // cache, the scratch pad creation, the oneDNN engine) must be thread-safe. These are the same requirements the
+    // graphs of the streams compiled concurrently from one model already rely on. The phases reading the state of
+    // the neighbour nodes (the optimal descriptor selection, the memory allocation) stay sequential.
+    void ForEachNode(const std::vector<NodePtr>& nodes, const std::function<void(const NodePtr&)>& func) const;
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
+    void InitParallelExecution();
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -255,6 +283,70 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // The parallel execution mode runs executableGraphNodes as a dependency DAG instead of the topological order.
+    // Successors and the number of predecessors are stored per index in executableGraphNodes.
+    bool parallelExecution = false;
+    std::vector<std::vector<size_t>> execSuccessors;
+    std::vector<size_t> execPredecessorsNum;
+    // (consumer, producer) pairs: the producer writes into memory, which is reused after the consumer has read it
+    std::vector<std::pair<Node*, Node*>> memReuseOrder;
+
+    // The output shapes of the dynamic graph nodes depend only on the input shapes and on the values of the inputs
+    // read by the data dependent nodes. So the shapes inferred for such a combination are stored per index in
+    // executableGraphNodes and reused.
+    struct ShapesCacheKey {
+        std::vector<VectorDims> inputShapes;
+        std::vector<std::vector<uint8_t>> inputValues;  // of shapesCacheValueInputs
+
+        size_t hash() const;
+        bool operator==(const ShapesCacheKey& rhs) const {
+            return inputShapes == rhs.inputShapes && inputValues == rhs.inputValues;
+        }
+    };
+    using ShapesCacheEntry = std::shared_ptr<std::vector<std::vector<VectorDims>>>;
+    std::unique_ptr<LruCache<ShapesCacheKey, ShapesCacheEntry>> shapesCache;
+    // the inputs whose values are read by the shape inference of the nodes
+    std::vector<NodePtr> shapesCacheValueInputs;
+    std::atomic<uint64_t> shapesCacheHits{0};
+    std::atomic<uint64_t> shapesCacheMisses{0};
+    // collects shapesCacheValueInputs, returns false if the shapes depend on the values which can't be a part of the key
+    bool InitShapesCacheValueInputs();
+    // returns false if the key of the current inputs is too large to be cached
+    bool GetShapesCacheKey(ShapesCacheKey& key) const;
+
+    // The dynamic tensors with the known lifetimes are placed in one arena instead of being allocated separately.
+    // Their allocation is deferred until the shapes of all the nodes are updated, then the arena layout is taken from
+    // the plans cache keyed by the sizes of the tensors, so the layout is solved once per sizes combination.
+    struct DynamicMemoryBox {
+        int start;
+        int finish;
+        std::vector<EdgePtr> edges;
+        DnnlMemoryMngrPtr memMngr;
+        MemoryMngrWithDeferredAllocation* deferredMngr;  // owned by memMngr
+    };
+    // Sizes of the dynamic memory boxes in the alignment units
+    struct DynamicMemoryPlanKey {
+        std::vector<int64_t> sizes;
+
+        size_t hash() const;
+        bool operator==(const DynamicMemoryPlanKey& rhs) const {
+            return sizes == rhs.sizes;
+        }
+    };
+    // Offsets (in the alignment units) of the dynamic memory boxes in the arena
+    struct DynamicMemoryPlan {
+        std::vector<int64_t> offsets;
+        int64_t totalSize = 0;
+    };
+    using DynamicMemoryPlanPtr = std::shared_ptr<DynamicMemoryPlan>;
+    std::vector<DynamicMemoryBox> dynamicMemoryBoxes;
+    std::unique_ptr<MemoryMngrWithReuse> dynamicMemoryArena;
+    std::unique_ptr<LruCache<DynamicMemoryPlanKey, DynamicMemoryPlanPtr>> dynamicMemoryPlans;
+    DynamicMemoryPlanPtr appliedMemoryPlan;
+
+    void DeferDynamicMemoryAllocation(bool defer);
+    void PlanDynamicMemory();
+
     GraphContext::CPtr context;
 
     void EnforceBF16();
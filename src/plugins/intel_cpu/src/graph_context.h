@@ -22,13 +22,17 @@ public:
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
                  std::shared_ptr<std::mutex> sharedMutex,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MultiCachePtr sharedParamsCache = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
           sharedMutex(sharedMutex),
+          rtSharedParamsCache(sharedParamsCache),
           isGraphQuantizedFlag(isGraphQuantized) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!rtSharedParamsCache)
+            rtSharedParamsCache = rtParamsCache;
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
 
@@ -52,6 +56,15 @@ public:
         return rtParamsCache;
     }
 
+    /**
+     * @brief Returns the cache which may be shared by the graphs of all the streams (CPU_RUNTIME_CACHE_SHARING),
+     * so its values are executed by several streams at the same time. Use it only for the values without
+     * any state changed during the execution (e.g. oneDNN primitives), the rest must use getParamsCache().
+     */
+    MultiCachePtr getSharedParamsCache() const {
+        return rtSharedParamsCache;
+    }
+
     DnnlScratchPadPtr getScratchPad() const {
         return rtScratchPad;
     }
@@ -71,7 +84,8 @@ private:
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
     std::shared_ptr<std::mutex> sharedMutex;  // mutex for protection of type-relaxed Op in clone_model()
 
-    MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtParamsCache;        // primitive cache of the graph
+    MultiCachePtr rtSharedParamsCache;  // primitive cache of the stateless values, may be shared between the streams
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
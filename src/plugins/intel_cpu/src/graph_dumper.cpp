@@ -17,6 +17,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <chrono>
 
 using namespace InferenceEngine;
 
@@ -337,6 +338,43 @@ void summary_perf(const Graph &graph) {
             std::cout << ss.str();
         }
     }
+    {
+        // timeline of the last inference: start offset and duration of each node,
+        // which shows how much the nodes were overlapped in the parallel execution mode
+        std::vector<NodePtr> A;
+        for (auto &node : graph.GetNodes()) {
+            if (node->PerfCounter().count() != 0)
+                A.push_back(node);
+        }
+        if (A.empty()) return;
+        sort(A.begin(), A.end(),
+            [](const NodePtr& a, const NodePtr& b){
+            return a->PerfCounter().startTime() < b->PerfCounter().startTime();
+        });
+
+        using us = std::chrono::duration<double, std::micro>;
+        const auto begin = A.front()->PerfCounter().startTime();
+        auto end = begin;
+        double busy = 0;
+        for (auto& node : A) {
+            end = std::max(end, node->PerfCounter().finishTime());
+            busy += us(node->PerfCounter().duration()).count();
+        }
+        const double span = us(end - begin).count();
+
+        std::cout << " timeline (last inference):" << std::endl;
+        std::cout << "     Span(us): " << span << " Busy(us): " << busy
+                  << " Overlap: " << std::fixed << std::setprecision(2) << (span > 0 ? busy / span : 0.0) << std::endl;
+        for (auto& node : A) {
+            std::stringstream ss;
+            ss << std::setw(12) << std::right << std::fixed << std::setprecision(1)
+               << us(node->PerfCounter().startTime() - begin).count() << " +"
+               << std::setw(8) << std::right << us(node->PerfCounter().duration()).count() << "(us)"
+               << " #" << node->getExecIndex()
+               << " " << node->getName() << std::endl;
+            std::cout << ss.str();
+        }
+    }
 }
 
 #endif
@@ -102,12 +102,12 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast state " << cur_id << " to VariableState";
+                    }
+                    // the state buffers are passed by pointer, the data isn't copied
+                    cur_node->assignState(cur_state->getStateMemory(), cur_state->getNextMemory());
                 }
             }
         }
@@ -124,12 +124,11 @@ void InferRequestBase::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast state " << cur_id << " to VariableState";
+                    }
+                    cur_state->updateState(cur_node->getStore());
                 }
             }
         }
@@ -11,10 +11,43 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name} {
+    stateMem = std::make_shared<Memory>(storage->getEngine());
+    stateMem->Create(storage->getDesc());
+    nextMem = std::make_shared<Memory>(storage->getEngine());
+    nextMem->Create(storage->getDesc());
+
+    cpu_memcpy(stateMem->GetData(), storage->GetData(), storage->GetSize());
+    updateStateBlob();
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(stateMem->GetData(), 0, stateMem->GetSize());
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW() << "Variable state " << name << " can't be set to an empty blob";
+    if (newState->byteSize() != stateMem->GetSize())
+        IE_THROW() << "Variable state " << name << " has size " << stateMem->GetSize()
+                   << " bytes, but the new state has " << newState->byteSize() << " bytes";
+
+    cpu_memcpy(stateMem->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
+}
+
+void VariableState::updateState(const MemoryPtr& current) {
+    if (current == stateMem)
+        return;
+    IE_ASSERT(current == nextMem) << "Variable state " << name << " received an unknown buffer";
+
+    std::swap(stateMem, nextMem);
+    updateStateBlob();
+}
+
+void VariableState::updateStateBlob() {
+    state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(stateMem->getDesc()), stateMem->GetData());
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
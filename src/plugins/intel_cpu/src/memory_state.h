@@ -15,16 +15,37 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Variable state with the double buffered storage.
+ * The storage is handed over to the MemoryInput node by pointer, so the ReadValue node reads the current buffer
+ * while the Assign node writes the next one. After the inference the buffers are swapped without copying the data.
+ * The state blob is a view on the current buffer, so the blob returned by GetState() is valid until the next inference.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    VariableState(std::string name, MemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    const MemoryPtr& getStateMemory() const {
+        return stateMem;
+    }
+
+    const MemoryPtr& getNextMemory() const {
+        return nextMem;
+    }
+
+    /**
+     * @brief Makes the provided buffer current. Expected to be one of the state buffers.
+     */
+    void updateState(const MemoryPtr& current);
+
+private:
+    void updateStateBlob();
+
+    MemoryPtr stateMem;
+    MemoryPtr nextMem;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,250 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_matmul_to_fc_compressed.hpp"
+#include "op/fully_connected_compressed.hpp"
+#include <functional>
+#include <numeric>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+
+namespace {
+
+// rt_info key of the Convert nodes which constant folding is disabled by MarkMatMulCompressedWeights
+const char* const compressed_weights_convert_key = "MatMulCompressedWeightsConvert";
+
+void disable_convert_folding(const std::shared_ptr<ngraph::Node>& convert) {
+    if (ov::pass::constant_folding_is_disabled(convert))
+        return;
+    ov::disable_constant_folding(convert);
+    convert->get_rt_info()[compressed_weights_convert_key] = true;
+}
+
+void enable_convert_folding(const std::shared_ptr<ngraph::Node>& convert) {
+    auto& rt_info = convert->get_rt_info();
+    if (rt_info.erase(compressed_weights_convert_key))
+        ov::enable_constant_folding(convert);
+}
+
+struct DecompressionPattern {
+    std::shared_ptr<ngraph::Node> weights;
+    std::shared_ptr<ngraph::Node> convert;
+    std::shared_ptr<ngraph::Node> subtract;
+    std::shared_ptr<ngraph::Node> zero_point;
+    std::shared_ptr<ngraph::Node> multiply;
+    std::shared_ptr<ngraph::Node> scale;
+    std::shared_ptr<ngraph::Node> reshape;
+    std::shared_ptr<ngraph::Node> matmul;
+};
+
+std::shared_ptr<ngraph::pattern::Matcher> make_decompression_matcher(const ngraph::element::TypeVector& weights_types,
+                                                                    const std::string& matcher_name,
+                                                                    ngraph::matcher_pass_callback& callback,
+                                                                    const std::function<bool(const DecompressionPattern&)>& handler) {
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(weights_types));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ weights_m }, ngraph::pattern::consumers_count(1));
+    auto zero_point_m = ngraph::pattern::any_input();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_point_m }, ngraph::pattern::consumers_count(1));
+    auto scale_m = ngraph::pattern::any_input();
+    auto multiply_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ convert_m, subtract_m });
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ multiply_input_m, scale_m }, ngraph::pattern::consumers_count(1));
+    auto reshape_m = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({ multiply_m, ngraph::pattern::any_input() },
+                                                                         ngraph::pattern::consumers_count(1));
+    auto matmul_weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ multiply_m, reshape_m });
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ ngraph::pattern::any_input(), matmul_weights_m });
+
+    callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto get = [&pattern_map](const std::shared_ptr<ngraph::Node>& label) -> std::shared_ptr<ngraph::Node> {
+            const auto it = pattern_map.find(label);
+            return it == pattern_map.end() ? nullptr : it->second.get_node_shared_ptr();
+        };
+
+        DecompressionPattern pattern;
+        pattern.weights = get(weights_m);
+        pattern.convert = get(convert_m);
+        pattern.subtract = get(subtract_m);
+        pattern.zero_point = pattern.subtract ? get(zero_point_m) : nullptr;
+        pattern.multiply = get(multiply_m);
+        pattern.scale = get(scale_m);
+        pattern.reshape = get(reshape_m);
+        pattern.matmul = get(matmul_m);
+        return handler(pattern);
+    };
+
+    return std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+}
+
+/*
+ * Returns the number of groups the decompression parameter of the given shape splits the input channels into:
+ * the parameter may vary along the output channels axis and along the outermost input channels axis only.
+ * Returns 0 if the parameter layout is not supported.
+ */
+size_t get_param_groups(ngraph::Shape param_shape, const ngraph::Shape& weights_shape, const std::vector<size_t>& in_axes) {
+    if (param_shape.size() > weights_shape.size())
+        return 0;
+    param_shape.insert(param_shape.begin(), weights_shape.size() - param_shape.size(), 1);
+    for (size_t i = 0; i < weights_shape.size(); i++) {
+        if (param_shape[i] != 1 && param_shape[i] != weights_shape[i])
+            return 0;
+    }
+    for (size_t i = 1; i < in_axes.size(); i++) {
+        if (param_shape[in_axes[i]] != 1)
+            return 0;
+    }
+    return param_shape[in_axes[0]];
+}
+
+// Broadcasts the decompression parameter to [O, G] layout
+std::vector<float> get_param_values(const std::shared_ptr<ngraph::opset1::Constant>& param, const ngraph::Shape& weights_shape,
+                                    size_t out_axis, size_t group_axis, size_t O, size_t G) {
+    auto param_shape = param->get_shape();
+    param_shape.insert(param_shape.begin(), weights_shape.size() - param_shape.size(), 1);
+    std::vector<size_t> strides(param_shape.size(), 1);
+    for (size_t i = param_shape.size() - 1; i > 0; i--)
+        strides[i - 1] = strides[i] * param_shape[i];
+
+    const auto values = param->cast_vector<float>();
+    const size_t o_stride = param_shape[out_axis] == 1 ? 0 : strides[out_axis];
+    const size_t g_stride = param_shape[group_axis] == 1 ? 0 : strides[group_axis];
+    std::vector<float> result(O * G);
+    for (size_t o = 0; o < O; o++) {
+        for (size_t g = 0; g < G; g++) {
+            result[o * G + g] = values[o * o_stride + g * g_stride];
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+ov::intel_cpu::MarkMatMulCompressedWeights::MarkMatMulCompressedWeights() {
+    MATCHER_SCOPE(MarkMatMulCompressedWeights);
+    ngraph::matcher_pass_callback callback;
+    auto m = make_decompression_matcher(
+        { ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4 },
+        matcher_name, callback,
+        [](const DecompressionPattern& pattern) {
+            disable_convert_folding(pattern.convert);
+            if (pattern.subtract)
+                ov::mark_as_dequantization_node(pattern.subtract);
+            ov::mark_as_dequantization_node(pattern.multiply);
+            return false;
+        });
+    this->register_matcher(m, callback);
+}
+
+ov::intel_cpu::ConvertMatMulToFCCompressed::ConvertMatMulToFCCompressed() {
+    MATCHER_SCOPE(ConvertMatMulToFCCompressed);
+    ngraph::matcher_pass_callback callback;
+    auto m = make_decompression_matcher(
+        { ngraph::element::u8, ngraph::element::i8 },
+        matcher_name, callback,
+        [](const DecompressionPattern& pattern) {
+            auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern.matmul);
+            auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern.weights);
+            auto scale = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern.scale);
+            auto zero_point = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern.zero_point);
+            if (!matmul || !weights || !scale || (pattern.subtract && !zero_point)) {
+                enable_convert_folding(pattern.convert);
+                return false;
+            }
+
+            auto is_supported = [&]() {
+                const auto activations_rank = matmul->get_input_partial_shape(0).rank();
+                const auto& decompressed_pshape = matmul->get_input_partial_shape(1);
+                if (matmul->get_transpose_a() || activations_rank.is_dynamic() || activations_rank.get_length() < 2 ||
+                    decompressed_pshape.is_dynamic() || decompressed_pshape.size() != 2)
+                    return false;
+                // the decompression must not broadcast the weights
+                const auto& weights_shape = weights->get_shape();
+                if (weights_shape.size() < 2 || weights_shape.size() > 3 ||
+                    pattern.multiply->get_output_partial_shape(0) != ngraph::PartialShape(weights_shape) ||
+                    (pattern.subtract && pattern.subtract->get_output_partial_shape(0) != ngraph::PartialShape(weights_shape)))
+                    return false;
+                return pattern.reshape || weights_shape.size() == 2;
+            };
+            if (!is_supported()) {
+                enable_convert_folding(pattern.convert);
+                return false;
+            }
+
+            // MatMul weights are [O, I] if transpose_b is set and [I, O] otherwise,
+            // the compressed weights are [O, I1, I2] or [I1, I2, O] correspondingly in case of grouped decompression
+            const auto& weights_shape = weights->get_shape();
+            const auto decompressed_shape = matmul->get_input_shape(1);
+            const bool transpose_b = matmul->get_transpose_b();
+            const size_t O = transpose_b ? decompressed_shape[0] : decompressed_shape[1];
+            const size_t I = transpose_b ? decompressed_shape[1] : decompressed_shape[0];
+            const size_t out_axis = transpose_b ? 0 : weights_shape.size() - 1;
+            std::vector<size_t> in_axes;
+            for (size_t i = 0; i < weights_shape.size(); i++) {
+                if (i != out_axis)
+                    in_axes.push_back(i);
+            }
+            const size_t in_size = std::accumulate(in_axes.begin(), in_axes.end(), size_t(1),
+                                                   [&](size_t acc, size_t axis) { return acc * weights_shape[axis]; });
+            const size_t scale_groups = get_param_groups(scale->get_shape(), weights_shape, in_axes);
+            const size_t zero_point_groups = zero_point ? get_param_groups(zero_point->get_shape(), weights_shape, in_axes) : 1;
+            const size_t G = std::max(scale_groups, zero_point_groups);
+            if (weights_shape[out_axis] != O || in_size != I || scale_groups == 0 || zero_point_groups == 0 ||
+                (scale_groups != 1 && scale_groups != G) || (zero_point_groups != 1 && zero_point_groups != G)) {
+                enable_convert_folding(pattern.convert);
+                return false;
+            }
+
+            ngraph::NodeVector new_ops;
+            std::shared_ptr<ngraph::opset1::Constant> fc_weights;
+            if (transpose_b) {
+                // the data is already in [O, I] layout, so it is shared with the original constant
+                fc_weights = std::make_shared<ngraph::opset1::Constant>(*weights, ngraph::Shape{ O, I });
+            } else {
+                const auto src = static_cast<const uint8_t*>(weights->get_data_ptr());
+                std::vector<uint8_t> transposed(O * I);
+                for (size_t i = 0; i < I; i++) {
+                    for (size_t o = 0; o < O; o++) {
+                        transposed[o * I + i] = src[i * O + o];
+                    }
+                }
+                fc_weights = std::make_shared<ngraph::opset1::Constant>(weights->get_element_type(), ngraph::Shape{ O, I }, transposed.data());
+            }
+            new_ops.push_back(fc_weights);
+
+            const size_t group_axis = in_axes[0];
+            const auto fc_scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ O, G },
+                                                                   get_param_values(scale, weights_shape, out_axis, group_axis, O, G));
+            const auto fc_zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ O, G },
+                zero_point ? get_param_values(zero_point, weights_shape, out_axis, group_axis, O, G) : std::vector<float>(O * G, 0.f));
+            new_ops.push_back(fc_scale);
+            new_ops.push_back(fc_zero_point);
+
+            auto fc = std::make_shared<ov::intel_cpu::FullyConnectedCompressedNode>(matmul->input_value(0),
+                                                                                   fc_weights,
+                                                                                   fc_scale,
+                                                                                   fc_zero_point,
+                                                                                   matmul->get_output_partial_shape(0).rank(),
+                                                                                   matmul->get_output_element_type(0));
+            fc->set_friendly_name(matmul->get_friendly_name());
+            new_ops.push_back(fc);
+            ngraph::copy_runtime_info(matmul, new_ops);
+            ngraph::replace_node(matmul, fc);
+            return true;
+        });
+    this->register_matcher(m, callback);
+}
+
+bool ov::intel_cpu::EnableMatMulCompressedWeightsFolding::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    RUN_ON_MODEL_SCOPE(EnableMatMulCompressedWeightsFolding);
+    for (const auto& node : m->get_ordered_ops()) {
+        if (ov::is_type<ngraph::opset1::Convert>(node))
+            enable_convert_folding(node);
+    }
+    return false;
+}
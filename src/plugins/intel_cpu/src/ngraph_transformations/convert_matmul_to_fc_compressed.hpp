@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     MarkMatMulCompressedWeights keeps the weights decompression subgraph of MatMul from being constant folded,
+ *     so that the weights stay compressed till ConvertMatMulToFCCompressed:
+ *
+ *       Constant (u8/i8/u4/i4)
+ *              |
+ *           Convert    zero point
+ *               \       /
+ *               Subtract (optional)   scale
+ *                    \               /
+ *                         Multiply
+ *                            |
+ *                 Reshape (optional, grouped decompression)
+ *                            |
+ *             Input    ->  MatMul
+ */
+class MarkMatMulCompressedWeights: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkMatMulCompressedWeights", "0");
+    MarkMatMulCompressedWeights();
+};
+
+/*
+ * Description:
+ *     ConvertMatMulToFCCompressed replaces MatMul with the decompression subgraph of the constant u8/i8 weights
+ *     (see MarkMatMulCompressedWeights) by FullyConnectedCompressed which decompresses the weights inside the kernel.
+ *     The weights are normalized to [O, I] layout, the scales and zero points - to [O, G] layout.
+ *     If the subgraph can't be converted, its constant folding is enabled back.
+ */
+class ConvertMatMulToFCCompressed: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ConvertMatMulToFCCompressed", "0");
+    ConvertMatMulToFCCompressed();
+};
+
+/*
+ * Description:
+ *     EnableMatMulCompressedWeightsFolding enables back the constant folding of the decompression Convert nodes
+ *     marked by MarkMatMulCompressedWeights, which are still present in the model after ConvertMatMulToFCCompressed
+ *     (e.g. the subgraph was changed by the transformations in between and is not matched anymore).
+ */
+class EnableMatMulCompressedWeightsFolding: public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("EnableMatMulCompressedWeightsFolding", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fully_connected_compressed.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::FullyConnectedCompressedNode::FullyConnectedCompressedNode(const ngraph::Output<Node>& A,
+                                                                         const ngraph::Output<Node>& W,
+                                                                         const ngraph::Output<Node>& scales,
+                                                                         const ngraph::Output<Node>& zero_points,
+                                                                         const ngraph::Rank& output_rank,
+                                                                         const ngraph::element::Type output_type)
+    : Op({A, W, scales, zero_points}), m_output_rank(output_rank), m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::FullyConnectedCompressedNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(FullyConnectedCompressedNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::FullyConnectedCompressedNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                                        m_output_rank, m_output_type);
+}
+
+void ov::intel_cpu::FullyConnectedCompressedNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(FullyConnectedCompressedNode_validate_and_infer_types);
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 4.");
+
+    const auto weights_type = get_input_element_type(1);
+    NODE_VALIDATION_CHECK(this,
+        weights_type == ngraph::element::u8 || weights_type == ngraph::element::i8,
+        "Weights type must be u8 or i8. Current value is: ",
+        weights_type);
+
+    // Weights shape: [O, I]; scales and zero points shape: [O, G]
+    const auto weights_pshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+        weights_pshape.is_static() && weights_pshape.size() == 2,
+        "Weights pshape must be static and have rank 2");
+    const auto o_channels = weights_pshape[0];
+    const auto i_channels = weights_pshape[1].get_length();
+
+    const auto scales_pshape = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(this,
+        scales_pshape.is_static() && scales_pshape.size() == 2 && scales_pshape[0] == o_channels &&
+        scales_pshape[1].get_length() > 0 && i_channels % scales_pshape[1].get_length() == 0,
+        "Scales shape is incorrect. Current value is: ",
+        scales_pshape,
+        ", expected: [",
+        o_channels,
+        ", G], where G divides ",
+        i_channels);
+    NODE_VALIDATION_CHECK(this,
+        get_input_partial_shape(3) == scales_pshape,
+        "Zero points shape must be equal to the scales shape");
+
+    // Activations shape: [B1, ..., Bn, I]; result shape: [B1, ..., Bn, O]
+    const auto activations_pshape = get_input_partial_shape(0);
+    ngraph::PartialShape output_pshape;
+    if (activations_pshape.rank().is_static()) {
+        output_pshape = activations_pshape;
+        output_pshape[output_pshape.size() - 1] = o_channels;
+
+        NODE_VALIDATION_CHECK(this,
+            m_output_rank.is_static(),
+            "Output rank must be static if activations rank is static.");
+
+        while (output_pshape.rank().get_length() < m_output_rank.get_length()) {
+            output_pshape.insert(output_pshape.begin(), 1);
+        }
+    } else {
+        output_pshape = ngraph::PartialShape::dynamic();
+    }
+
+    auto output_type = m_output_type == ngraph::element::undefined ? get_input_element_type(0) : m_output_type;
+    set_output_type(0, output_type, output_pshape);
+}
+
+bool ov::intel_cpu::FullyConnectedCompressedNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(FullyConnectedCompressedNode_visit_attributes);
+    visitor.on_attribute("out-rank", m_output_rank);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
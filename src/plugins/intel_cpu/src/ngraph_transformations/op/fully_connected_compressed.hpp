@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * FullyConnected with weight-only compressed weights:
+ *     Y = A * ((W - ZP) * S)^T
+ * where W is u8/i8 weights [O, I], S and ZP are f32 per output channel group scales and zero points [O, G],
+ * each group covers I / G consecutive input channels.
+ */
+class FullyConnectedCompressedNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("FullyConnectedCompressed", "cpu_plugin_opset");
+
+    FullyConnectedCompressedNode() = default;
+
+    FullyConnectedCompressedNode(const ngraph::Output<Node> &A,
+                                 const ngraph::Output<Node> &W,
+                                 const ngraph::Output<Node> &scales,
+                                 const ngraph::Output<Node> &zero_points,
+                                 const ngraph::Rank& output_rank,
+                                 const ngraph::element::Type output_type = ngraph::element::undefined);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    ngraph::Rank get_output_rank() const { return m_output_rank; }
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+private:
+    ngraph::Rank m_output_rank;
+    ngraph::element::Type m_output_type;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -550,14 +550,35 @@ std::vector<memory::format_tag> Node::getAvailableFormatsForDims(const Shape &di
     return {memory::format_tag::any};
 }
 
-void Node::updateShapes() {
+bool Node::updateShapes() {
     IE_ASSERT(isDynamicNode()) << "Node::updateShapes() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
     if (needShapeInfer()) {
         auto result = shapeInfer();
         if (ShapeInferStatus::success == result.status) {
             redefineOutputMemory(result.dims);
+        } else {
+            return false;
         }
     }
+    return true;
+}
+
+void Node::updateShapes(const std::vector<VectorDims>& outputShapes) {
+    IE_ASSERT(isDynamicNode()) << "Node::updateShapes() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
+    if (needShapeInfer()) {
+        redefineOutputMemory(outputShapes);
+    }
+}
+
+std::vector<VectorDims> Node::getOutputMemoryShapes() const {
+    std::vector<VectorDims> result;
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto edges = getChildEdgesAtPort(i);
+        if (edges.empty())
+            IE_THROW() << "Node " << getName() << " has no memory at output port " << i;
+        result.push_back(edges[0]->getMemory().getStaticDims());
+    }
+    return result;
 }
 
 void Node::updateDynamicParams() {
@@ -801,6 +822,7 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
                     internalBlob->buffer(), internalBlob->byteSize());
 
             const std::string string_hash = name + "_" + std::to_string(i)
+                                            + "_" + intDescs[i]->serializeFormat()
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
@@ -839,7 +861,7 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
 
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
         _ptr->Create(weightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(srcMemory, *_ptr, context->getSharedParamsCache());
 
         return _ptr;
     };
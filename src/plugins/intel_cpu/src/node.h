@@ -335,7 +335,19 @@ public:
     void resolveInPlaceEdges();
 
     virtual void execute(dnnl::stream strm) = 0;
-    void updateShapes();
+    /**
+     * @brief Infers the output shapes and redefines the output memory if the input shapes have changed
+     * @return false if the output shapes are defined during the node execution
+     */
+    bool updateShapes();
+    /**
+     * @brief Redefines the output memory using the output shapes inferred earlier for the same input shapes
+     */
+    void updateShapes(const std::vector<VectorDims>& outputShapes);
+    /**
+     * @brief Returns the current output memory shapes
+     */
+    std::vector<VectorDims> getOutputMemoryShapes() const;
     void updateDynamicParams();
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
@@ -382,6 +394,11 @@ public:
         this->typeStr = typeStr;
     }
 
+    // replaces the scratch pad of the context, must be called before the primitives are created
+    void setScratchPad(DnnlScratchPadPtr pad) {
+        scratchPad = std::move(pad);
+    }
+
     virtual size_t descInputNumbers() {
         return 1;
     }
@@ -652,7 +669,8 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            auto pad = scratchPad ? scratchPad : context->getScratchPad();
+            scratchpadMem = pad->createScratchPadMem(desc);
         }
         return scratchpadMem;
     }
@@ -683,6 +701,7 @@ private:
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    DnnlScratchPadPtr scratchPad;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
@@ -14,6 +14,7 @@
 #include <utils/bfloat16.hpp>
 #include <utils/general_utils.h>
 #include <vector>
+#include "kernels/pooling_uni_kernel.hpp"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -183,6 +184,26 @@ void AdaptivePooling::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void AdaptivePooling::createPrimitive() {
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        IE_THROW() << errorPrefix << "doesn't have primitive descriptors.";
+    if (!selectedPD->getConfig().inConfs[0].getMemDesc()->hasLayoutType(LayoutType::ncsp)) {
+        PoolingKernelConfParams jcp;
+        jcp.algorithm = algorithm == Algorithm::AdaptivePoolingMax ? PoolingKernelAlgorithm::MAX : PoolingKernelAlgorithm::AVG;
+        jcp.withIndices = algorithm == Algorithm::AdaptivePoolingMax;
+        if (mayiuse(avx512_core)) {
+            poolingKernel.reset(new PoolingKernel<avx512_core>(jcp));
+        } else if (mayiuse(avx2)) {
+            poolingKernel.reset(new PoolingKernel<avx2>(jcp));
+        }
+        if (poolingKernel)
+            poolingKernel->create_ker();
+    }
+
+    Node::createPrimitive();
+}
+
 void AdaptivePooling::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -300,25 +321,70 @@ void AdaptivePooling::execute(dnnl::stream strm) {
         pool = poolAvg;
     }
 
-    parallel_for5d(N, blockCount, OD, OH, OW,
-        [&](int n, int blkIdx, int od, int oh, int ow) {
-        auto srcData = src + n * inStrides[0] + blkIdx * inStrides[1];
-        auto dstData = dst + n * outStrides[0] + blkIdx * outStrides[1] +
-                       od * outStrides[2] + oh * outStrides[3] + ow * outStrides[4];
-        int cStart = 0, cEnd = C, inResidual = 0, outResidual = 0;
-        if (!isTailCFmt) {
-            cStart = blkIdx * blockSize;
-            cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
-        }
-        for (int c = cStart; c < cEnd; c++) {
-            if (isTailCFmt) {
-                inResidual = c * inStrides[1];
-                outResidual = c * outStrides[1];
-            } else if (!isPlainFmt) {
-                inResidual = outResidual = c % blockSize;
+    // the channels of the bin are contiguous in memory for nspc and blocked layouts
+    const int jitStep = poolingKernel && !isPlainFmt ? static_cast<int>(poolingKernel->getDataElPerVec()) : 0;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        std::vector<int32_t> windowOffsets, windowIndices, windowMaxIndices;
+        for_5d(ithr, nthr, N, blockCount, OD, OH, OW, [&](int n, int blkIdx, int od, int oh, int ow) {
+            auto srcData = src + n * inStrides[0] + blkIdx * inStrides[1];
+            auto dstData = dst + n * outStrides[0] + blkIdx * outStrides[1] +
+                           od * outStrides[2] + oh * outStrides[3] + ow * outStrides[4];
+            int cStart = 0, cEnd = C, inResidual = 0, outResidual = 0;
+            if (!isTailCFmt) {
+                cStart = blkIdx * blockSize;
+                cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
+            }
+            int c = cStart;
+            if (jitStep != 0 && cEnd - cStart >= jitStep) {
+                size_t dStart, dEnd, hStart, hEnd, wStart, wEnd;
+                setBinBorders(&dStart, &dEnd, od, ID, OD);
+                setBinBorders(&hStart, &hEnd, oh, IH, OH);
+                setBinBorders(&wStart, &wEnd, ow, IW, OW);
+                windowOffsets.clear();
+                windowIndices.clear();
+                for (size_t pixD = dStart; pixD < dEnd; pixD++) {
+                    for (size_t pixH = hStart; pixH < hEnd; pixH++) {
+                        for (size_t pixW = wStart; pixW < wEnd; pixW++) {
+                            windowOffsets.push_back(static_cast<int32_t>(pixD * inStrides[2] + pixH * inStrides[3] + pixW * inStrides[4]));
+                            windowIndices.push_back(static_cast<int32_t>(pixD * iHW + pixH * IW + pixW));
+                        }
+                    }
+                }
+                if (windowOffsets.empty())
+                    IE_THROW() << errorPrefix << "has empty bin";
+
+                const int workAmount = (cEnd - cStart) - (cEnd - cStart) % jitStep;
+                windowMaxIndices.resize(workAmount);
+                const float avgScale = 1.f / windowOffsets.size();
+                PoolingKernelExecArgs args;
+                args.src = srcData;
+                args.dst = dstData;
+                args.indices = windowMaxIndices.data();
+                args.windowOffsets = windowOffsets.data();
+                args.windowIndices = windowIndices.data();
+                args.avgScale = &avgScale;
+                args.windowSize = windowOffsets.size();
+                args.workAmount = workAmount;
+                (*poolingKernel)(&args);
+
+                // the indices output is planar
+                if (algorithm == Algorithm::AdaptivePoolingMax) {
+                    for (int i = 0; i < workAmount; i++)
+                        indexDst[(n * C + cStart + i) * oDHW + od * oHW + oh * OW + ow] = windowMaxIndices[i];
+                }
+                c += workAmount;
+            }
+            for (; c < cEnd; c++) {
+                if (isTailCFmt) {
+                    inResidual = c * inStrides[1];
+                    outResidual = c * outStrides[1];
+                } else if (!isPlainFmt) {
+                    inResidual = outResidual = c % blockSize;
+                }
+                pool(srcData + inResidual, dstData + outResidual, od, oh, ow, n * C + c);
             }
-            pool(srcData + inResidual, dstData + outResidual, od, oh, ow, n * C + c);
-        }});
+        });
+    });
 }
 
 bool AdaptivePooling::created() const {
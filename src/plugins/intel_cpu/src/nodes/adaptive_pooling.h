@@ -12,6 +12,9 @@
 
 namespace ov {
 namespace intel_cpu {
+
+class PoolingKernelBase;
+
 namespace node {
 
 class AdaptivePooling : public Node {
@@ -20,6 +23,7 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -30,6 +34,8 @@ private:
     mutable std::vector<Dim> spatialDimsValue = {};
     InferenceEngine::Precision precision = InferenceEngine::Precision::FP32;
     inline void setBinBorders(size_t *startPtr, size_t *endPtr, size_t idx, size_t inputLength, size_t outputLength);
+    // reduces the bins of the channels that are contiguous in memory (nspc and blocked layouts)
+    std::shared_ptr<PoolingKernelBase> poolingKernel;
 
     std::string errorPrefix;
 
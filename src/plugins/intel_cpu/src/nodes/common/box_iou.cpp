@@ -0,0 +1,162 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "box_iou.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+namespace {
+
+template <IouMode mode>
+inline float iouScalar(const float* box, float min0, float min1, float max0, float max1, float area, float offset) {
+    if (mode != IouMode::Clamped) {
+        if (min0 > box[2] || max0 < box[0] || min1 > box[3] || max1 < box[1])
+            return 0.f;
+    } else if (box[4] <= 0.f || area <= 0.f) {
+        return 0.f;
+    }
+
+    float side0 = (std::min)(box[2], max0) - (std::max)(box[0], min0) + offset;
+    float side1 = (std::min)(box[3], max1) - (std::max)(box[1], min1) + offset;
+    if (mode == IouMode::Clamped) {
+        side0 = (std::max)(side0, 0.f);
+        side1 = (std::max)(side1, 0.f);
+    } else if (mode == IouMode::Intersected && (side0 <= 0.f || side1 <= 0.f)) {
+        return 0.f;
+    }
+
+    const float inter = side0 * side1;
+    return inter / (box[4] + area - inter);
+}
+
+template <IouMode mode>
+float boxIou(const float* box, const float* boxes, size_t stride, size_t num, float offset, float* iou) {
+    const float* min0 = boxes;
+    const float* min1 = boxes + stride;
+    const float* max0 = boxes + 2 * stride;
+    const float* max1 = boxes + 3 * stride;
+    const float* area = boxes + 4 * stride;
+
+    float maxIou = 0.f;
+    size_t j = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 vMin0I = _mm512_set1_ps(box[0]);
+    const __m512 vMin1I = _mm512_set1_ps(box[1]);
+    const __m512 vMax0I = _mm512_set1_ps(box[2]);
+    const __m512 vMax1I = _mm512_set1_ps(box[3]);
+    const __m512 vAreaI = _mm512_set1_ps(box[4]);
+    const __m512 vOffset = _mm512_set1_ps(offset);
+    const __m512 vZero = _mm512_setzero_ps();
+    const __mmask16 kAreaI = box[4] > 0.f ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>(0);
+    __m512 vMaxIou = vZero;
+
+    for (; j + 16 <= num; j += 16) {
+        const __m512 vMin0J = _mm512_loadu_ps(min0 + j);
+        const __m512 vMin1J = _mm512_loadu_ps(min1 + j);
+        const __m512 vMax0J = _mm512_loadu_ps(max0 + j);
+        const __m512 vMax1J = _mm512_loadu_ps(max1 + j);
+        const __m512 vAreaJ = _mm512_loadu_ps(area + j);
+
+        __m512 vSide0 = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(vMax0I, vMax0J), _mm512_max_ps(vMin0I, vMin0J)), vOffset);
+        __m512 vSide1 = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(vMax1I, vMax1J), _mm512_max_ps(vMin1I, vMin1J)), vOffset);
+        __mmask16 kValid;
+        if (mode == IouMode::Clamped) {
+            kValid = kAreaI & _mm512_cmp_ps_mask(vAreaJ, vZero, _CMP_GT_OQ);
+            vSide0 = _mm512_max_ps(vSide0, vZero);
+            vSide1 = _mm512_max_ps(vSide1, vZero);
+        } else {
+            kValid = _mm512_cmp_ps_mask(vMin0J, vMax0I, _CMP_LE_OQ) & _mm512_cmp_ps_mask(vMax0J, vMin0I, _CMP_GE_OQ) &
+                     _mm512_cmp_ps_mask(vMin1J, vMax1I, _CMP_LE_OQ) & _mm512_cmp_ps_mask(vMax1J, vMin1I, _CMP_GE_OQ);
+            if (mode == IouMode::Intersected)
+                kValid &= _mm512_cmp_ps_mask(vSide0, vZero, _CMP_GT_OQ) & _mm512_cmp_ps_mask(vSide1, vZero, _CMP_GT_OQ);
+        }
+
+        const __m512 vInter = _mm512_mul_ps(vSide0, vSide1);
+        const __m512 vUnion = _mm512_sub_ps(_mm512_add_ps(vAreaI, vAreaJ), vInter);
+        const __m512 vIou = _mm512_maskz_div_ps(kValid, vInter, vUnion);
+        if (iou)
+            _mm512_storeu_ps(iou + j, vIou);
+        // the accumulator is the second operand to skip NaN like std::max does
+        vMaxIou = _mm512_max_ps(vIou, vMaxIou);
+    }
+    maxIou = _mm512_reduce_max_ps(vMaxIou);
+#elif defined(HAVE_AVX2)
+    const __m256 vMin0I = _mm256_set1_ps(box[0]);
+    const __m256 vMin1I = _mm256_set1_ps(box[1]);
+    const __m256 vMax0I = _mm256_set1_ps(box[2]);
+    const __m256 vMax1I = _mm256_set1_ps(box[3]);
+    const __m256 vAreaI = _mm256_set1_ps(box[4]);
+    const __m256 vOffset = _mm256_set1_ps(offset);
+    const __m256 vZero = _mm256_setzero_ps();
+    const __m256 vAreaIValid = _mm256_cmp_ps(vAreaI, vZero, _CMP_GT_OQ);
+    __m256 vMaxIou = vZero;
+
+    for (; j + 8 <= num; j += 8) {
+        const __m256 vMin0J = _mm256_loadu_ps(min0 + j);
+        const __m256 vMin1J = _mm256_loadu_ps(min1 + j);
+        const __m256 vMax0J = _mm256_loadu_ps(max0 + j);
+        const __m256 vMax1J = _mm256_loadu_ps(max1 + j);
+        const __m256 vAreaJ = _mm256_loadu_ps(area + j);
+
+        __m256 vSide0 = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vMax0I, vMax0J), _mm256_max_ps(vMin0I, vMin0J)), vOffset);
+        __m256 vSide1 = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vMax1I, vMax1J), _mm256_max_ps(vMin1I, vMin1J)), vOffset);
+        __m256 vValid;
+        if (mode == IouMode::Clamped) {
+            vValid = _mm256_and_ps(vAreaIValid, _mm256_cmp_ps(vAreaJ, vZero, _CMP_GT_OQ));
+            vSide0 = _mm256_max_ps(vSide0, vZero);
+            vSide1 = _mm256_max_ps(vSide1, vZero);
+        } else {
+            vValid = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(vMin0J, vMax0I, _CMP_LE_OQ), _mm256_cmp_ps(vMax0J, vMin0I, _CMP_GE_OQ)),
+                                   _mm256_and_ps(_mm256_cmp_ps(vMin1J, vMax1I, _CMP_LE_OQ), _mm256_cmp_ps(vMax1J, vMin1I, _CMP_GE_OQ)));
+            if (mode == IouMode::Intersected)
+                vValid = _mm256_and_ps(vValid, _mm256_and_ps(_mm256_cmp_ps(vSide0, vZero, _CMP_GT_OQ),
+                                                             _mm256_cmp_ps(vSide1, vZero, _CMP_GT_OQ)));
+        }
+
+        const __m256 vInter = _mm256_mul_ps(vSide0, vSide1);
+        const __m256 vUnion = _mm256_sub_ps(_mm256_add_ps(vAreaI, vAreaJ), vInter);
+        const __m256 vIou = _mm256_and_ps(vValid, _mm256_div_ps(vInter, vUnion));
+        if (iou)
+            _mm256_storeu_ps(iou + j, vIou);
+        // the accumulator is the second operand to skip NaN like std::max does
+        vMaxIou = _mm256_max_ps(vIou, vMaxIou);
+    }
+    __m128 vMax4 = _mm_max_ps(_mm256_castps256_ps128(vMaxIou), _mm256_extractf128_ps(vMaxIou, 1));
+    vMax4 = _mm_max_ps(vMax4, _mm_movehl_ps(vMax4, vMax4));
+    vMax4 = _mm_max_ss(vMax4, _mm_shuffle_ps(vMax4, vMax4, 1));
+    maxIou = _mm_cvtss_f32(vMax4);
+#endif
+
+    for (; j < num; j++) {
+        const float res = iouScalar<mode>(box, min0[j], min1[j], max0[j], max1[j], area[j], offset);
+        if (iou)
+            iou[j] = res;
+        maxIou = (std::max)(maxIou, res);
+    }
+    return maxIou;
+}
+
+}  // namespace
+
+float box_iou(const float* box, const float* boxes, size_t stride, size_t num, IouMode mode, float offset, float* iou) {
+    switch (mode) {
+    case IouMode::Clamped:
+        return boxIou<IouMode::Clamped>(box, boxes, stride, num, offset, iou);
+    case IouMode::Overlapped:
+        return boxIou<IouMode::Overlapped>(box, boxes, stride, num, offset, iou);
+    default:
+        return boxIou<IouMode::Intersected>(box, boxes, stride, num, offset, iou);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * The nodes define IoU of the degenerate and the disjoint boxes differently, each mode keeps the semantic of its node.
+ * In all the modes the sides of the intersection are extended by the coordinates offset (1 for the not normalized boxes).
+ */
+enum class IouMode {
+    // MulticlassNms: the intersection sides are clamped to zero, boxes with non-positive area have zero IoU
+    Clamped,
+    // MatrixNms: disjoint boxes have zero IoU
+    Overlapped,
+    // DetectionOutput: disjoint boxes and boxes with empty intersection have zero IoU
+    Intersected
+};
+
+/*
+ * The box layout used by box_iou: {min0, min1, max0, max1, area}, the area is precomputed by the caller.
+ * The boxes block is stored in SoA layout: the k-th component of the j-th box is located at boxes[k * stride + j].
+ */
+constexpr size_t boxIouComponents = 5;
+
+namespace XARCH {
+
+// Computes IoU of the box with each box of the block and returns the maximum of them, iou may be nullptr.
+float box_iou(const float* box, const float* boxes, size_t stride, size_t num, IouMode mode, float offset, float* iou);
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
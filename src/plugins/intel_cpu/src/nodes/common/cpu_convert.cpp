@@ -26,35 +26,110 @@ namespace ov {
 namespace intel_cpu {
 namespace {
 
-template <typename src_t, typename dst_t>
-void convert_vec(jit_generator & gen,
-                 const RegExp & src,
-                 const RegExp & dst);
+// Loads 8 values of the given precision to the fp32 lanes of the vector
+void load_vec(jit_generator & gen,
+              Precision prc,
+              const Ymm & vec,
+              const RegExp & src) {
+    switch (prc) {
+        case Precision::FP32:
+            gen.vmovups(vec, gen.yword[src]);
+            break;
+        case Precision::I32:
+            gen.vcvtdq2ps(vec, gen.yword[src]);
+            break;
+        case Precision::FP16:
+            gen.vcvtph2ps(vec, gen.xword[src]);
+            break;
+        case Precision::BF16:
+            gen.vpmovzxwd(vec, gen.xword[src]);
+            gen.vpslld(vec, vec, 16);
+            break;
+        case Precision::U8:
+            gen.vpmovzxbd(vec, gen.qword[src]);
+            gen.vcvtdq2ps(vec, vec);
+            break;
+        case Precision::I8:
+            gen.vpmovsxbd(vec, gen.qword[src]);
+            gen.vcvtdq2ps(vec, vec);
+            break;
+        default:
+            IE_THROW() << "jit_convert_array doesn't support " << prc << " precision";
+    }
+}
 
-template <>
-void convert_vec<ov::float16, float>(jit_generator & gen,
-                                     const RegExp & src,
-                                     const RegExp & dst) {
-    auto const & f16vec = gen.xmm3;
-    auto const & f32vec = gen.ymm4;
-
-    gen.movdqu(f16vec, gen.xword[src]);
-    gen.vcvtph2ps(f32vec, f16vec);
-    gen.vmovups(gen.yword[dst], f32vec);
+// Stores the fp32 lanes of the vector as 8 values of the given precision, the vector is clobbered
+void store_vec(jit_generator & gen,
+               Precision prc,
+               const Ymm & vec,
+               const Ymm & tmp,
+               const RegExp & dst) {
+    const Xmm xvec(vec.getIdx());
+    const Xmm xtmp(tmp.getIdx());
+
+    switch (prc) {
+        case Precision::FP32:
+            gen.vmovups(gen.yword[dst], vec);
+            break;
+        case Precision::I32:
+            gen.vcvttps2dq(vec, vec);
+            gen.vmovdqu(gen.yword[dst], vec);
+            break;
+        case Precision::FP16:
+            gen.vcvtps2ph(gen.xword[dst], vec, 0);
+            break;
+        case Precision::BF16:
+            // the same rounding as ov::intel_cpu::bfloat16_t: bits + ((bits & 0x10000) >> 1)
+            gen.vpsrld(tmp, vec, 16);
+            gen.vpslld(tmp, tmp, 31);
+            gen.vpsrld(tmp, tmp, 16);
+            gen.vpaddd(vec, vec, tmp);
+            gen.vpsrld(vec, vec, 16);
+            gen.vextracti128(xtmp, vec, 1);
+            gen.vpackusdw(xvec, xvec, xtmp);
+            gen.vmovdqu(gen.xword[dst], xvec);
+            break;
+        case Precision::U8:
+        case Precision::I8:
+            // the values are already clamped to the destination range, so the packing saturation is a no-op
+            gen.vcvttps2dq(vec, vec);
+            gen.vextracti128(xtmp, vec, 1);
+            gen.vpackssdw(xvec, xvec, xtmp);
+            if (prc == Precision::U8)
+                gen.vpackuswb(xvec, xvec, xvec);
+            else
+                gen.vpacksswb(xvec, xvec, xvec);
+            gen.vmovq(gen.qword[dst], xvec);
+            break;
+        default:
+            IE_THROW() << "jit_convert_array doesn't support " << prc << " precision";
+    }
 }
 
+template <typename T>
+struct JitConvertPrecision : std::integral_constant<Precision::ePrecision, Precision::UNSPECIFIED> {};
 template <>
-void convert_vec<float, ov::float16>(jit_generator & gen,
-                                     const RegExp & src,
-                                     const RegExp & dst) {
-    auto const & f16vec = gen.xmm3;
-    auto const & f32vec = gen.ymm4;
-
-    gen.vmovups(f32vec, gen.yword[src]);
-    gen.vcvtps2ph(f16vec, f32vec, 0);
-    gen.movdqu(gen.xword[dst], f16vec);
-}
+struct JitConvertPrecision<float> : std::integral_constant<Precision::ePrecision, Precision::FP32> {};
+template <>
+struct JitConvertPrecision<int32_t> : std::integral_constant<Precision::ePrecision, Precision::I32> {};
+template <>
+struct JitConvertPrecision<ov::float16> : std::integral_constant<Precision::ePrecision, Precision::FP16> {};
+template <>
+struct JitConvertPrecision<ov::intel_cpu::bfloat16_t> : std::integral_constant<Precision::ePrecision, Precision::BF16> {};
+template <>
+struct JitConvertPrecision<uint8_t> : std::integral_constant<Precision::ePrecision, Precision::U8> {};
+template <>
+struct JitConvertPrecision<int8_t> : std::integral_constant<Precision::ePrecision, Precision::I8> {};
+
+// i32 -> i32 is excluded since fp32 doesn't keep all the i32 values
+template <typename src_t, typename dst_t>
+struct JitConvertible : std::integral_constant<bool, JitConvertPrecision<src_t>::value != Precision::UNSPECIFIED
+                                                     && JitConvertPrecision<dst_t>::value != Precision::UNSPECIFIED
+                                                     && !(std::is_same<src_t, int32_t>::value
+                                                          && std::is_same<dst_t, int32_t>::value)> {};
 
+// Converts the array through fp32: dst = dst_t(trunc(max(min(src, ubound), lbound)))
+// NaN values are passed through the clamping as std::min/std::max do
 class jit_convert_array : public jit_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_convert_array)
 
@@ -69,12 +144,15 @@ class jit_convert_array : public jit_kernel {
         auto dst = arg(&args_t::out);
         auto size = arg(&args_t::count);
 
+        vbroadcastss(_lbound, argPtr(&args_t::lbound));
+        vbroadcastss(_ubound, argPtr(&args_t::ubound));
+
         size >>= vlen_log2;
 
         foreach(0, size, [&, this](const Xbyak::Reg64& idx) {
-            _convert_vec(*this, src, dst);
-            src += _src_size * vlen;
-            dst += _dst_size * vlen;
+            convert_vec(src, dst);
+            src += _src_prc.size() * vlen;
+            dst += _dst_prc.size() * vlen;
         });
 
         mov(size, argPtr(&args_t::count));
@@ -89,45 +167,53 @@ class jit_convert_array : public jit_kernel {
             auto tail_size = var<size_t>();
 
             tail_size = size;
-            tail_size <<= static_cast<size_t>(std::logb(_src_size)) - 1;
-            copy<uint16_t>(tmp.pointer(), src, tail_size);
+            tail_size <<= static_cast<size_t>(std::logb(_src_prc.size()));
+            copy<uint8_t>(tmp.pointer(), src, tail_size);
 
-            _convert_vec(*this, tmp.pointer(), tmp.pointer());
+            convert_vec(tmp.pointer(), tmp.pointer());
 
             tail_size = size;
-            tail_size <<= static_cast<size_t>(std::logb(_dst_size)) - 1;
-            copy<uint16_t>(dst, tmp.pointer(), tail_size);
+            tail_size <<= static_cast<size_t>(std::logb(_dst_prc.size()));
+            copy<uint8_t>(dst, tmp.pointer(), tail_size);
         });
 
         postamble();
     }
 
+    void convert_vec(const RegExp & src, const RegExp & dst) {
+        load_vec(*this, _src_prc, _vec, src);
+        // the value is the second operand to keep NaN
+        vminps(_vec, _ubound, _vec);
+        vmaxps(_vec, _lbound, _vec);
+        if (_trunc)
+            vroundps(_vec, _vec, 3);
+        store_vec(*this, _dst_prc, _vec, _tmp, dst);
+    }
+
 public:
     typedef struct {
         const void* src;
         void* out;
         const size_t count;
+        float lbound;
+        float ubound;
     } args_t;
 
     typedef void (*fn_t)(const args_t*);
 
-    typedef void (*convert_vec_t)(jit_generator &,
-                                  const RegExp &,
-                                  const RegExp &);
-
-    jit_convert_array(convert_vec_t convert_vec,
-                      size_t src_size,
-                      size_t dst_size)
+    jit_convert_array(Precision src_prc,
+                      Precision dst_prc,
+                      bool trunc)
         : jit_kernel(jit_name())
-        , _convert_vec(convert_vec)
-        , _src_size(src_size)
-        , _dst_size(dst_size) {}
+        , _src_prc(src_prc)
+        , _dst_prc(dst_prc)
+        , _trunc(trunc) {}
 
-    template<typename src_t, typename dst_t>
+    template<typename src_t, typename dst_t, bool trunc>
     static fn_t get() {
         if (mayiuse(cpu_isa_t::avx2)
             && dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C)) {
-            static jit_convert_array converter(convert_vec<src_t, dst_t>, sizeof(src_t), sizeof(dst_t));
+            static jit_convert_array converter(JitConvertPrecision<src_t>::value, JitConvertPrecision<dst_t>::value, trunc);
             auto & generator = static_cast<jit_generator&>(converter);
             generator.create_kernel();
             return (fn_t)generator.jit_ker();
@@ -136,18 +222,31 @@ public:
     }
 
 private:
-    convert_vec_t _convert_vec;
-    size_t _src_size;
-    size_t _dst_size;
+    Precision _src_prc;
+    Precision _dst_prc;
+    bool _trunc;
+    const Xbyak::Ymm _vec = Xbyak::Ymm(0);
+    const Xbyak::Ymm _tmp = Xbyak::Ymm(1);
+    const Xbyak::Ymm _lbound = Xbyak::Ymm(2);
+    const Xbyak::Ymm _ubound = Xbyak::Ymm(3);
 };
 
+template <typename src_t, typename dst_t, bool trunc>
+jit_convert_array::fn_t jit_converter() {
+    static auto converter = jit_convert_array::get<src_t, dst_t, trunc>();
+    return converter;
+}
+
+constexpr float no_lbound = -std::numeric_limits<float>::infinity();
+constexpr float no_ubound = std::numeric_limits<float>::infinity();
+
 template <typename TI, typename TO>
 void jit_convert(const TI* arg, TO* out, size_t count) {
     using jit_impl = jit_convert_array;
-    static auto converter = jit_impl::get<TI, TO>();
+    auto converter = jit_converter<TI, TO, false>();
 
     if (converter) {
-        typename jit_impl::args_t args = { arg, out, count };
+        typename jit_impl::args_t args = { arg, out, count, no_lbound, no_ubound };
         converter(&args);
     } else {
         for (size_t i = 0; i < count; ++i) {
@@ -156,6 +255,30 @@ void jit_convert(const TI* arg, TO* out, size_t count) {
     }
 }
 
+// Converts the whole array in parallel with the jit kernel, returns false if the kernel isn't available
+template <typename src_t, typename dst_t,
+          typename std::enable_if<JitConvertible<src_t, dst_t>::value, bool>::type = true>
+bool try_jit_convert(const src_t* src, dst_t* dst, size_t size, float lbound, float ubound, bool trunc) {
+    auto converter = trunc ? jit_converter<src_t, dst_t, true>() : jit_converter<src_t, dst_t, false>();
+    if (!converter)
+        return false;
+
+    // big enough blocks to amortize the scheduling, small enough to balance the threads
+    constexpr size_t block = 16384;
+    parallel_for(ov::intel_cpu::div_up(size, block), [&](size_t i) {
+        const size_t offset = i * block;
+        jit_convert_array::args_t args = { src + offset, dst + offset, std::min(size - offset, block), lbound, ubound };
+        converter(&args);
+    });
+    return true;
+}
+
+template <typename src_t, typename dst_t,
+          typename std::enable_if<!JitConvertible<src_t, dst_t>::value, bool>::type = true>
+bool try_jit_convert(const src_t*, dst_t*, size_t, float, float, bool) {
+    return false;
+}
+
 template <Precision::ePrecision p>
 struct PrecisionInfo {
     using value_type = typename PrecisionTrait<p>::value_type;
@@ -176,6 +299,29 @@ struct PrecisionInfo<Precision::BOOL> {
     using value_type = uint8_t;
 };
 
+// The next value of the type towards zero
+inline float step_to_zero(float value) {
+    return std::nextafter(value, 0.f);
+}
+
+inline double step_to_zero(double value) {
+    return std::nextafter(value, 0.0);
+}
+
+// the 16-bit float types are sign-magnitude, so decreasing the bits decreases the magnitude
+inline ov::float16 step_to_zero(ov::float16 value) {
+    return ov::float16::from_bits(value.to_bits() - 1);
+}
+
+inline ov::intel_cpu::bfloat16_t step_to_zero(ov::intel_cpu::bfloat16_t value) {
+    return ov::intel_cpu::bfloat16_t::from_bits(value.to_bits() - 1);
+}
+
+template <typename T>
+T step_to_zero(T value) {
+    return value > 0 ? value - 1 : value + 1;
+}
+
 template<typename T,
          typename U = typename std::conditional<
                         std::is_same<ov::float16, T>::value
@@ -185,6 +331,8 @@ struct Range {
     const std::tuple<U, U> & fit(const Precision & prec);
 
 private:
+    void round_to_limits(long double lbound, long double ubound);
+
     std::tuple<U, U> _range {
         std::numeric_limits<T>::lowest(),
         std::numeric_limits<T>::max()
@@ -217,6 +365,7 @@ const std::tuple<U, U> & Range<T, U>::fit(const Precision & prec) {
         }
         std::get<0>(_range) = static_cast<U>(std::max(static_cast<double>(std::get<0>(_range)), lbound));
         std::get<1>(_range) = static_cast<U>(std::min(static_cast<double>(std::get<1>(_range)), ubound));
+        round_to_limits(lbound, ubound);
     } else {
         int64_t lbound;
         uint64_t ubound;
@@ -265,10 +414,25 @@ const std::tuple<U, U> & Range<T, U>::fit(const Precision & prec) {
                             double, uint64_t>::type;
         std::get<0>(_range) = static_cast<U>(std::max(static_cast<ltype>(std::get<0>(_range)), static_cast<ltype>(lbound)));
         std::get<1>(_range) = static_cast<U>(std::min(static_cast<utype>(std::get<1>(_range)), static_cast<utype>(ubound)));
+        round_to_limits(lbound, ubound);
     }
     return _range;
 }
 
+// The bounds may be rounded outwards in T (e.g. int32 max to 2^31 in float or f16 max to 2^16 in bf16), so they are
+// moved towards zero to the values of T within the limits, otherwise the clamped values overflow the destination
+template<typename T, typename U>
+void Range<T, U>::round_to_limits(long double lbound, long double ubound) {
+    T lower = static_cast<T>(std::get<0>(_range));
+    while (static_cast<long double>(static_cast<U>(lower)) < lbound)
+        lower = step_to_zero(lower);
+    T upper = static_cast<T>(std::get<1>(_range));
+    while (static_cast<long double>(static_cast<U>(upper)) > ubound)
+        upper = step_to_zero(upper);
+    std::get<0>(_range) = static_cast<U>(lower);
+    std::get<1>(_range) = static_cast<U>(upper);
+}
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
@@ -296,6 +460,12 @@ struct ConvertPrecision<std::tuple<src_t, dst_t>> {
         src_t lbound, ubound;
         std::tie(lbound, ubound) = ctx.range<src_t>();
 
+        if (try_jit_convert(src, dst, ctx.size, static_cast<float>(lbound), static_cast<float>(ubound),
+                            !ctx.interimPrc.is_float())) {
+            ctx.converted = true;
+            return;
+        }
+
         if (std::is_integral<src_t>::value
             || ctx.interimPrc.is_float()
             || std::is_integral<dst_t>::value) {
@@ -319,12 +489,20 @@ struct ConvertPrecision<std::tuple<float, ov::intel_cpu::bfloat16_t>> {
         auto dst = static_cast<ov::intel_cpu::bfloat16_t *>(ctx.dstPtr);
 
         if (ctx.interimPrc.is_float()) {
+            if (try_jit_convert(src, dst, ctx.size, no_lbound, no_ubound, false)) {
+                ctx.converted = true;
+                return;
+            }
             parallel_for(ctx.size, [&](size_t i) {
                 dst[i] = static_cast<ov::intel_cpu::bfloat16_t>(src[i]);
             });
         } else {
             float lbound, ubound;
             std::tie(lbound, ubound) = ctx.range<float>();
+            if (try_jit_convert(src, dst, ctx.size, lbound, ubound, true)) {
+                ctx.converted = true;
+                return;
+            }
             parallel_for(ctx.size, [&](size_t i) {
                 dst[i] = static_cast<ov::intel_cpu::bfloat16_t>(std::trunc(std::max(std::min(src[i], ubound), lbound)));
             });
@@ -341,12 +519,20 @@ struct ConvertPrecision<std::tuple<ov::intel_cpu::bfloat16_t, float>> {
         auto dst = static_cast<float *>(ctx.dstPtr);
 
         if (ctx.interimPrc.is_float()) {
+            if (try_jit_convert(src, dst, ctx.size, no_lbound, no_ubound, false)) {
+                ctx.converted = true;
+                return;
+            }
             parallel_for(ctx.size, [&](size_t i) {
                 dst[i] = static_cast<float>(src[i]);
             });
         } else {
             float lbound, ubound;
             std::tie(lbound, ubound) = ctx.range<ov::intel_cpu::bfloat16_t>();
+            if (try_jit_convert(src, dst, ctx.size, lbound, ubound, true)) {
+                ctx.converted = true;
+                return;
+            }
             parallel_for(ctx.size, [&](size_t i) {
                 dst[i] = std::trunc(std::max(std::min(static_cast<float>(src[i]), ubound), lbound));
             });
@@ -369,6 +555,12 @@ struct ConvertPrecision<std::tuple<src_t, ov::float16>> {
         src_t lbound, ubound;
         std::tie(lbound, ubound) = ctx.range<src_t>();
 
+        if (try_jit_convert(src, dst, ctx.size, static_cast<float>(lbound), static_cast<float>(ubound),
+                            !ctx.interimPrc.is_float())) {
+            ctx.converted = true;
+            return;
+        }
+
         if (std::is_integral<src_t>::value
             || ctx.interimPrc.is_float()) {
             parallel_for(iterations, [&](size_t i) {
@@ -407,6 +599,11 @@ struct ConvertPrecision<std::tuple<ov::float16, dst_t>> {
         float lbound, ubound;
         std::tie(lbound, ubound) = ctx.range<ov::float16>();
 
+        if (try_jit_convert(src, dst, ctx.size, lbound, ubound, !ctx.interimPrc.is_float())) {
+            ctx.converted = true;
+            return;
+        }
+
         if (ctx.interimPrc.is_float()
             || std::is_integral<dst_t>::value) {
             parallel_for(iterations, [&](size_t i) {
@@ -447,7 +644,7 @@ struct ConvertPrecision<std::tuple<ov::float16, ov::float16>> {
 
         if (ctx.interimPrc.is_float()) {
             cpu_memcpy(dst, src, ctx.size * sizeof(ov::float16));
-        } else {
+        } else if (!try_jit_convert(src, dst, ctx.size, lbound, ubound, true)) {
             parallel_for(iterations, [&](size_t i) {
                 batch_type tmp;
                 const size_t offset = i * batch;
@@ -24,11 +24,11 @@ DnnlExecutor::IntermReorder::IntermReorder(const dnnl::memory::desc& descSrc,
     m_reorder = dnnl::reorder(reorderPd);
 }
 
-void DnnlExecutor::IntermReorder::exec(dnnl::memory& memSrc, dnnl::memory& memDst, dnnl::stream strm) {
+void DnnlExecutor::IntermReorder::exec(dnnl::memory& memSrc, dnnl::memory& memDst, dnnl::stream strm) const {
     m_reorder.execute(strm, memSrc, memDst);
 }
 
-void DnnlExecutor::exec(const std::unordered_map<int, dnnl::memory>& primArgs, dnnl::stream strm) {
+void DnnlExecutor::exec(const std::unordered_map<int, dnnl::memory>& primArgs, dnnl::stream strm) const {
     if (inputReorders.empty() && outputReorders.empty()) {
         execPrim.execute(strm, primArgs);
     } else {
@@ -36,8 +36,8 @@ void DnnlExecutor::exec(const std::unordered_map<int, dnnl::memory>& primArgs, d
     }
 }
 
-void DnnlExecutor::reorder_exec(std::unordered_map<int, dnnl::memory> primArgs, dnnl::stream strm) {
-    for (auto &inReorder : inputReorders) {
+void DnnlExecutor::reorder_exec(std::unordered_map<int, dnnl::memory> primArgs, dnnl::stream strm) const {
+    for (const auto &inReorder : inputReorders) {
         if (primArgs.count(inReorder.first)) {
             dnnl::memory memDst(inReorder.second.getDstDesc(), strm.get_engine());
             inReorder.second.exec(primArgs[inReorder.first], memDst, strm);
@@ -47,7 +47,7 @@ void DnnlExecutor::reorder_exec(std::unordered_map<int, dnnl::memory> primArgs,
         }
     }
     std::unordered_map<int, dnnl::memory> outputMem;
-    for (auto &outReorder : outputReorders) {
+    for (const auto &outReorder : outputReorders) {
         if (primArgs.count(outReorder.first)) {
             dnnl::memory memSrc(outReorder.second.getSrcDesc(), strm.get_engine());
             outputMem[outReorder.first] = primArgs[outReorder.first];
@@ -57,7 +57,7 @@ void DnnlExecutor::reorder_exec(std::unordered_map<int, dnnl::memory> primArgs,
         }
     }
     execPrim.execute(strm, primArgs);
-    for (auto &outReorder : outputReorders) {
+    for (const auto &outReorder : outputReorders) {
         outReorder.second.exec(primArgs[outReorder.first], outputMem[outReorder.first], strm);
     }
 }
@@ -15,7 +15,7 @@ class DnnlExecutor {
         class IntermReorder {
             public:
                 IntermReorder(const dnnl::memory::desc& descSrc, const dnnl::memory::desc& descDst, const dnnl::engine& engine);
-                void exec(dnnl::memory& memSrc, dnnl::memory& memDst, dnnl::stream strm);
+                void exec(dnnl::memory& memSrc, dnnl::memory& memDst, dnnl::stream strm) const;
                 const dnnl::memory::desc& getSrcDesc() const { return m_descSrc; }
                 const dnnl::memory::desc& getDstDesc() const { return m_descDst; }
 
@@ -27,7 +27,8 @@ class DnnlExecutor {
 
     public:
         explicit DnnlExecutor(const dnnl::primitive_desc& pd);
-        void exec(const std::unordered_map<int, dnnl::memory>& primArgs, dnnl::stream strm);
+        // the executor may be executed by several streams at the same time, so the execution must not change its state
+        void exec(const std::unordered_map<int, dnnl::memory>& primArgs, dnnl::stream strm) const;
         bool needReordering() const;
         virtual ~DnnlExecutor() = default;
         dnnl::primitive getExecPrim() const;
@@ -61,7 +62,7 @@ class DnnlExecutor {
         }
 
     protected:
-        void reorder_exec(std::unordered_map<int, dnnl::memory> primArgs, dnnl::stream strm);
+        void reorder_exec(std::unordered_map<int, dnnl::memory> primArgs, dnnl::stream strm) const;
 
     protected:
         dnnl::primitive execPrim;
@@ -1475,7 +1475,7 @@ void Convolution::prepareParams() {
 
     auto prevExecPtr = execPtr;
     execPtr = nullptr;
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
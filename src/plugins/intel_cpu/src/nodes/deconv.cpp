@@ -972,7 +972,7 @@ void Deconvolution::prepareParams() {
     };
 
     execPtr = nullptr;
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -885,8 +885,8 @@ void DeformableConvolution::initSupportedPrimitiveDescriptors() {
     }
 }
 
-void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(
-        const float* offsets, const float* modulation, bool enforceRef) {
+void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(int *pSampledCoordsVector, float *pInterpWeightsVector,
+        const float* offsets, const float* modulation, bool enforceRef) const {
     const int MB = jcp.mb;
     const int OH = jcp.oh;
     const int OW = jcp.ow;
@@ -1021,8 +1021,6 @@ DeformableConvolution::DefConvExecutor::DefConvExecutor(const DefConvAttr &defCo
     offStrides = descVector[OFF_ID]->getStrides();
     weiStrides = descVector[WEI_ID]->getStrides();
     dstStrides = std::vector<size_t>(dstDesc->getStrides().size());
-    pSampledCoordsVector = nullptr;
-    pInterpWeightsVector = nullptr;
     for (int i = 0; i < srcDesc->getStrides().size(); i++) {
         srcStrides[srcDesc->getOrder()[i]] = srcDesc->getStrides()[i];
     }
@@ -1107,10 +1105,8 @@ DeformableConvolution::DefConvJitExecutor::DefConvJitExecutor(const DefConvAttr
 
 void DeformableConvolution::DefConvRefExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
-        int *pSampledCoordsVector, float *pInterpWeightsVector) {
-    this->pSampledCoordsVector = pSampledCoordsVector;
-    this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, true);
+        int *pSampledCoordsVector, float *pInterpWeightsVector) const {
+    prepareSamplingWeights(pSampledCoordsVector, pInterpWeightsVector, offsets, modulation, true);
     const int G = jcp.ngroups;
     const int MB = jcp.mb;
     const int OH = jcp.oh;
@@ -1225,7 +1221,8 @@ void DeformableConvolution::prepareParams() {
 
     execPtr = nullptr;
 
-    auto cache = context->getParamsCache();
+    // the executor keeps no state during the execution, so it may be shared between the streams
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, [] (const DefConvKey& key) -> std::shared_ptr<DefConvExecutor> {
         if (key.implType == impl_desc_type::ref) {
             return std::make_shared<DefConvRefExecutor>(key.defConvAttr, key.descVector);
@@ -1245,10 +1242,8 @@ void DeformableConvolution::executeDynamicImpl(dnnl::stream strm) {
 
 void DeformableConvolution::DefConvJitExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
-        int *pSampledCoordsVector, float *pInterpWeightsVector) {
-    this->pSampledCoordsVector = pSampledCoordsVector;
-    this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, false);
+        int *pSampledCoordsVector, float *pInterpWeightsVector) const {
+    prepareSamplingWeights(pSampledCoordsVector, pInterpWeightsVector, offsets, modulation, false);
     size_t buffer_size = (size_t)jcp.nthr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
     std::vector<float> input_buffer(buffer_size, 0);
     float* input_buffer_ptr = input_buffer.data();
@@ -113,21 +113,21 @@ private:
             DefConvExecutor(const DefConvAttr &defConvAttr,
                                 const std::vector<std::shared_ptr<BlockedMemoryDesc>> &descVector);
 
+            // the sampling buffers are passed by the node, since the executor may be shared between the streams
             virtual void exec(const float* src, const float* offsets,
                 const float* weights, const float* modulation, float* dst,
-                int *pSampledCoordsVector, float *pInterpWeightsVector) = 0;
+                int *pSampledCoordsVector, float *pInterpWeightsVector) const = 0;
             virtual ~DefConvExecutor() = default;
 
         protected:
-            void prepareSamplingWeights(const float* offsets, const float* modulation = nullptr, bool enforceRef = false);
+            void prepareSamplingWeights(int *pSampledCoordsVector, float *pInterpWeightsVector,
+                const float* offsets, const float* modulation = nullptr, bool enforceRef = false) const;
             jit_def_conv_params jcp = {};
             VectorDims srcStrides;
             VectorDims offStrides;
             VectorDims weiStrides;
             VectorDims modStrides;
             VectorDims dstStrides;
-            int *pSampledCoordsVector;
-            float *pInterpWeightsVector;
     };
 
     class DefConvRefExecutor : public DefConvExecutor {
@@ -138,7 +138,7 @@ private:
 
             void exec(const float* src, const float* offsets,
                 const float* weights, const float* modulation, float* dst,
-                int *pSampledCoordsVector, float *pInterpWeightsVector) override;
+                int *pSampledCoordsVector, float *pInterpWeightsVector) const override;
     };
 
     class DefConvJitExecutor : public DefConvExecutor {
@@ -149,7 +149,7 @@ private:
 
             void exec(const float* src, const float* offsets,
                 const float* weights, const float* modulation, float* dst,
-                int *pSampledCoordsVector, float *pInterpWeightsVector) override;
+                int *pSampledCoordsVector, float *pInterpWeightsVector) const override;
     };
 
     std::shared_ptr<DefConvExecutor> execPtr = nullptr;
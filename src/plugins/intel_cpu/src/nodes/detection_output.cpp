@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -9,6 +10,7 @@
 #include <onednn/dnnl.h>
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
+#include "common/box_iou.hpp"
 #include "detection_output.h"
 
 using namespace dnnl;
@@ -305,9 +307,12 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            // each class writes its detections to its own range, so the merge needs no lock
+            std::vector<int> classOffsets(classesNum + 1, 0);
+            for (int c = 0; c < classesNum; ++c)
+                classOffsets[c + 1] = classOffsets[c] + detectionsData[n * classesNum + c];
+            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap(classOffsets[classesNum]);
 
-            std::mutex mtx;
             parallel_for(classesNum, [&](int c) {
                 int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
@@ -316,14 +321,12 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
+                    confIndicesClassMap[classOffsets[c] + i] = std::make_pair(pconf[pr], std::make_pair(c, pr));
                 }
             });
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
@@ -725,68 +728,52 @@ inline void DetectionOutput::topk(const int *indicesIn, int *indicesOut, const f
                            ConfidenceComparatorDO(conf));
 }
 
-static inline float JaccardOverlap(const float *decodedBbox,
-                                   const float *bboxSizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decodedBbox[idx1 * 4 + 0];
-    float ymin1 = decodedBbox[idx1 * 4 + 1];
-    float xmax1 = decodedBbox[idx1 * 4 + 2];
-    float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    float xmin2 = decodedBbox[idx2 * 4 + 0];
-    float ymin2 = decodedBbox[idx2 * 4 + 1];
-    float xmax2 = decodedBbox[idx2 * 4 + 2];
-    float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth  = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
+// the kept boxes are checked in blocks to stop at the first suppressing block
+constexpr size_t iouBlock = 64;
 
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0f;
-    }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
+// Stores the decoded box {xmin, ymin, xmax, ymax} with its size to the box_iou layout with the given stride
+static inline void storeBox(const float* decodedBbox, const float* bboxSizes, const int idx, float* dst, const size_t stride) {
+    dst[0] = decodedBbox[idx * 4 + 0];
+    dst[stride] = decodedBbox[idx * 4 + 1];
+    dst[2 * stride] = decodedBbox[idx * 4 + 2];
+    dst[3 * stride] = decodedBbox[idx * 4 + 3];
+    dst[4 * stride] = bboxSizes[idx];
 }
 
-inline void DetectionOutput::NMSCF(int* indicesIn,
-                                        int& detections,
-                                        int* indicesOut,
-                                        const float* bboxes,
-                                        const float* boxSizes) {
-    // nms for this class
-    int countIn = detections;
-    detections = 0;
+// Hard NMS over the candidates sorted by confidence, indicesOut may alias indicesIn, returns the number of the kept boxes
+static inline int NMS(const int* indicesIn, const int countIn, int* indicesOut,
+                      const float* bboxes, const float* bboxSizes, const float threshold) {
+    // the kept boxes in the box_iou layout
+    const size_t stride = countIn;
+    std::vector<float> kept(boxIouComponents * stride);
+    float candidate[boxIouComponents];
+
+    int detections = 0;
     for (int i = 0; i < countIn; ++i) {
         const int prior = indicesIn[i];
+        storeBox(bboxes, bboxSizes, prior, candidate, 1);
 
         bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
+        for (size_t block = 0; block < static_cast<size_t>(detections) && keep; block += iouBlock) {
+            const size_t num = (std::min)(iouBlock, detections - block);
+            keep = XARCH::box_iou(candidate, kept.data() + block, stride, num, IouMode::Intersected, 0.f, nullptr) <= threshold;
         }
         if (keep) {
+            storeBox(bboxes, bboxSizes, prior, &kept[detections], stride);
             indicesOut[detections] = prior;
             detections++;
         }
     }
+    return detections;
+}
+
+inline void DetectionOutput::NMSCF(int* indicesIn,
+                                        int& detections,
+                                        int* indicesOut,
+                                        const float* bboxes,
+                                        const float* boxSizes) {
+    // nms for this class
+    detections = NMS(indicesIn, detections, indicesOut, bboxes, boxSizes, NMSThreshold);
 }
 
 inline void DetectionOutput::NMSMX(int* indicesIn,
@@ -798,34 +785,22 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
     int countIn = detections[0];
     detections[0] = 0;
 
+    // the classes are suppressed independently, so the candidates are split by class keeping the confidence order
+    // and each class list is suppressed in place in parallel
     for (int i = 0; i < countIn; ++i) {
         const int idx = indicesIn[i];
         const int cls = idx / priorsNum;
         const int prior = idx % priorsNum;
+        indicesOut[cls * priorsNum + detections[cls]++] = prior;
+    }
 
-        // nms within this class
-        int &ndetection = detections[cls];
+    parallel_for(classesNum, [&](int cls) {
+        if (detections[cls] == 0)
+            return;
         int *pindices = indicesOut + cls * priorsNum;
-
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0f;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-
-        if (keep) {
-            pindices[ndetection++] = prior;
-        }
-    }
+        const int shift = isShareLoc ? 0 : cls * priorsNum;
+        detections[cls] = NMS(pindices, detections[cls], pindices, bboxes + shift * 4, sizes + shift, NMSThreshold);
+    });
 }
 
 inline void DetectionOutput::generateOutput(float* reorderedConfData, int* indicesData, int* detectionsData, float* decodedBboxesData,
@@ -48,11 +48,13 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    if (inDataPrecision == Precision::BF16 && !isJitTableSupported(inDataPrecision))
         inDataPrecision = Precision::FP32;
+    // the bf16 rows are accumulated in f32, so the per sample weights are taken in f32
+    const auto weightsPrecision = inDataPrecision == Precision::BF16 ? Precision::FP32 : inDataPrecision;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -69,9 +71,14 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, weightsPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
+}
+
+void EmbeddingBagOffsetSum::createPrimitive() {
+    createKernel(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getDesc().getPrecision());
+    Node::createPrimitive();
 }
 
 void EmbeddingBagOffsetSum::prepareParams() {
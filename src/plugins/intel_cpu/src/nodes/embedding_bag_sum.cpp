@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,8 +12,11 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 namespace ov {
 namespace intel_cpu {
@@ -46,19 +51,51 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+bool EmbeddingBagSum::isJitTableSupported(const InferenceEngine::Precision& tablePrc) {
+    if (tablePrc == Precision::BF16)
+        return x64::mayiuse(x64::avx512_core);
+    return tablePrc == Precision::FP32 && x64::mayiuse(x64::avx2);
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const InferenceEngine::Precision& tablePrc) {
+    if (!isJitTableSupported(tablePrc))
+        return impl_desc_type::ref_any;
+    return x64::mayiuse(x64::avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void EmbeddingBagSum::createKernel(const InferenceEngine::Precision& tablePrc) {
+    if (_kernel || !isJitTableSupported(tablePrc))
+        return;
+
+    if (x64::mayiuse(x64::avx512_core)) {
+        _kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<x64::avx512_core>(tablePrc));
+    } else {
+        _kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<x64::avx2>(tablePrc));
+    }
+    _kernel->create_ker();
+}
+
+void EmbeddingBagSum::splitBags(size_t bagsNum, const int nthr, const int ithr, size_t& start, size_t& end) const {
+    const size_t total = _bagsIndicesPrefix[bagsNum];
+    const size_t costBegin = total * ithr / nthr;
+    const size_t costEnd = total * (ithr + 1) / nthr;
+    const auto first = _bagsIndicesPrefix.begin();
+    const auto last = first + bagsNum;
+    start = std::lower_bound(first, last, costBegin) - first;
+    end = ithr == nthr - 1 ? bagsNum : std::lower_bound(first, last, costEnd) - first;
+}
+
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
-    initFromInputs();
-
     const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->GetPtr());
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitBags(outputBagsNum, nthr, ithr, start, end);
         if (start >= end)
             return;
 
@@ -119,8 +156,91 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData, const InferenceEngine::Precision& srcPrc,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<uint8_t *>(outMemory->GetPtr());
+    const size_t rowStride = _embDepth * srcPrc.size();
+    // the columns tail that doesn't fill the whole vector register is summed up here
+    const size_t jitWorkAmount = _embDepth - _embDepth % _kernel->vector_size;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitBags(outputBagsNum, nthr, ithr, start, end);
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            uint8_t* dst = dstData + obi * rowStride;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr) {
+                std::memset(dst, 0, rowStride);
+                continue;
+            }
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+            const float* weights = withWeights && _withWeights ? weightsData + weightsIdx : nullptr;
+
+            if (jitWorkAmount != 0) {
+                jit_args_emb_bag_sum args;
+                args.table = srcData;
+                args.indices = indices;
+                args.weights = weights;
+                args.dst = dst;
+                args.indices_num = indicesSize;
+                args.row_stride = rowStride;
+                args.work_amount = jitWorkAmount;
+                (*_kernel)(&args);
+            }
+
+            for (size_t i = jitWorkAmount; i < _embDepth; i++) {
+                float sum = 0.f;
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    const size_t srcIndex = indices[inIdx] * _embDepth + i;
+                    const float value = srcPrc == Precision::BF16 ?
+                            static_cast<float>(reinterpret_cast<const bfloat16_t*>(srcData)[srcIndex]) :
+                            reinterpret_cast<const float*>(srcData)[srcIndex];
+                    sum += weights ? value * weights[inIdx] : value;
+                }
+                if (srcPrc == Precision::BF16)
+                    reinterpret_cast<bfloat16_t*>(dst)[i] = bfloat16_t(sum);
+                else
+                    reinterpret_cast<float*>(dst)[i] = sum;
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    initFromInputs();
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    _bagsIndicesPrefix.resize(outputBagsNum + 1);
+    _bagsIndicesPrefix[0] = 0;
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        const int* indices = nullptr;
+        size_t indicesSize = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        _bagsIndicesPrefix[obi + 1] = _bagsIndicesPrefix[obi] + std::max(indicesSize, size_t(1));
+    }
+
+    if (_kernel && one_of(srcPrc, Precision::FP32, Precision::BF16)) {
+        return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
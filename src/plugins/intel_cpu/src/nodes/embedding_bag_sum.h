@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "kernels/embedding_bag_sum_uni_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -28,6 +29,13 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    // f32 and bf16 tables are processed by the jit kernel, the output has the precision of the table. The bf16 rows are
+    // accumulated in f32 and the sums are rounded to bf16 once, so bf16 tables need avx512_core for the conversion.
+    // The int8 tables quantized per row are not dequantized on the fly: the dequantization subgraph of the table
+    // is constant and is folded into the f32 table when the graph is compiled, the kernel reads that table.
+    static bool isJitTableSupported(const InferenceEngine::Precision& tablePrc);
+    static impl_desc_type getImplType(const InferenceEngine::Precision& tablePrc);
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -38,10 +46,16 @@ protected:
             bool& withWeights) = 0;
 
     void prepareParams(const VectorDims& indexStaticShape);
+    void createKernel(const InferenceEngine::Precision& tablePrc);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData, const InferenceEngine::Precision& srcPrc,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+
+    // splits the bags over the threads so that each thread gets about the same number of indices
+    void splitBags(size_t bagsNum, const int nthr, const int ithr, size_t& start, size_t& end) const;
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +65,9 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_sum_kernel> _kernel;
+    std::vector<size_t> _bagsIndicesPrefix;
 };
 
 }   // namespace node
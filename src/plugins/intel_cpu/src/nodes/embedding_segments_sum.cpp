@@ -51,11 +51,13 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    if (inDataPrecision == Precision::BF16 && !isJitTableSupported(inDataPrecision))
         inDataPrecision = Precision::FP32;
+    // the bf16 rows are accumulated in f32, so the per sample weights are taken in f32
+    const auto weightsPrecision = inDataPrecision == Precision::BF16 ? Precision::FP32 : inDataPrecision;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -73,9 +75,14 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, weightsPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
+}
+
+void EmbeddingSegmentsSum::createPrimitive() {
+    createKernel(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getDesc().getPrecision());
+    Node::createPrimitive();
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
@@ -89,6 +96,17 @@ void EmbeddingSegmentsSum::initFromInputs() {
     segmentIds_ = reinterpret_cast<const int *>(getParentEdgeAt(SEGMENT_ID_IDX)->getMemoryPtr()->GetPtr());
     lastNumSegments_ = getNumSegments();
 
+    // the indices of each segment are located in one pass instead of scanning all the segment ids per segment
+    segmentsBegin_.assign(lastNumSegments_, 0lu);
+    segmentsSize_.assign(lastNumSegments_, 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= lastNumSegments_)
+            continue;
+        if (segmentsSize_[segmentId]++ == 0)
+            segmentsBegin_[segmentId] = si;
+    }
+
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
@@ -99,17 +117,12 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
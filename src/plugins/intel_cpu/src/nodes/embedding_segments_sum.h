@@ -21,6 +21,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -47,6 +48,8 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+    std::vector<size_t> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace node
@@ -393,7 +393,7 @@ void FullyConnected::prepareParams() {
         return execPtr;
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     if (!result.first) {
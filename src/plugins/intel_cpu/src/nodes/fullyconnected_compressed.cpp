@@ -0,0 +1,339 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "fullyconnected_compressed.h"
+#include "ie_parallel.hpp"
+#include "common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include <openvino/op/constant.hpp>
+#include <onednn/dnnl.h>
+#include "ngraph_transformations/op/fully_connected_compressed.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+class FCCompressedShapeInfer : public ShapeInferEmptyPads {
+public:
+    FCCompressedShapeInfer(size_t outputRank) : outRank(outputRank) {}
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const VectorDims& activationShape = input_shapes[0].get();
+        const VectorDims& weightShape = input_shapes[1].get();
+
+        // activation   weight    output_shape
+        // TNC          CoC       TNCo
+        // NC           CoC       NCo
+        VectorDims outputShape(outRank, 1);
+        std::copy(activationShape.begin(), activationShape.end(), outputShape.end() - activationShape.size());
+        outputShape.back() = weightShape[0];
+        return {{std::move(outputShape)}, ShapeInferStatus::success};
+    }
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    size_t outRank;
+};
+
+class FCCompressedShapeInferFactory : public ShapeInferFactory {
+public:
+    FCCompressedShapeInferFactory(const std::shared_ptr<ov::Node>& op) : m_op(op) {}
+    ShapeInferPtr makeShapeInfer() const override {
+        const auto fc = ov::as_type_ptr<FullyConnectedCompressedNode>(m_op);
+        if (!fc) {
+            IE_THROW(Unexpected) << "Wrong operation type";
+        }
+        return std::make_shared<FCCompressedShapeInfer>(fc->get_output_rank().get_length());
+    }
+private:
+    std::shared_ptr<ov::Node> m_op;
+};
+
+inline float dotProduct(const float* a, const float* b, size_t size) {
+    // independent partial sums let the compiler vectorize the reduction
+    constexpr size_t lanes = 16;
+    float acc[lanes] = {};
+    size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        for (size_t l = 0; l < lanes; l++)
+            acc[l] += a[i + l] * b[i + l];
+    }
+    float sum = 0.f;
+    for (size_t l = 0; l < lanes; l++)
+        sum += acc[l];
+    for (; i < size; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+template <typename T>
+inline void decompressGroup(const T* weights, size_t begin, size_t end, float scale, float zeroPoint, float* row) {
+    for (size_t i = begin; i < end; i++)
+        row[i] = (static_cast<float>(weights[i]) - zeroPoint) * scale;
+}
+
+inline void decompressGroupU4(const uint8_t* weights, size_t begin, size_t end, float scale, float zeroPoint, float* row) {
+    for (size_t i = begin; i < end; i++)
+        row[i] = (static_cast<float>((weights[i >> 1] >> ((i & 1) << 2)) & 0xF) - zeroPoint) * scale;
+}
+}   // namespace
+
+bool FullyConnectedCompressed::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto fc = ov::as_type_ptr<const FullyConnectedCompressedNode>(op);
+        if (!fc) {
+            errorMessage = "Only FullyConnectedCompressed from CPU internal opset is supported";
+            return false;
+        }
+        if (fc->get_input_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support activations with dynamic rank";
+            return false;
+        }
+        for (size_t port = 1; port < fc->get_input_size(); port++) {
+            if (!ov::is_type<ov::op::v0::Constant>(fc->get_input_node_ptr(port))) {
+                errorMessage = "Only Constant weights and decompression parameters are supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+FullyConnectedCompressed::FullyConnectedCompressed(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, FCCompressedShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    const auto& weightsShape = op->get_input_shape(WEIGHTS_ID);
+    OC = weightsShape[0];
+    IC = weightsShape[1];
+    groups = op->get_input_shape(SCALES_ID)[1];
+}
+
+void FullyConnectedCompressed::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataPrecision = getOriginalInputPrecisionAtPort(DATA_ID);
+    if (dataPrecision != Precision::BF16)
+        dataPrecision = Precision::FP32;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
+                          {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)},
+                          {LayoutType::ncsp, Precision::FP32},
+                          {LayoutType::ncsp, Precision::FP32}},
+                         {{LayoutType::ncsp, dataPrecision}},
+                         ref_any,
+                         isDynamicNode());
+}
+
+void FullyConnectedCompressed::createPrimitive() {
+    prepareWeights();
+    Node::createPrimitive();
+}
+
+void FullyConnectedCompressed::prepareWeights() {
+    const auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const bool isSigned = weightsMem->getDesc().getPrecision() == Precision::I8;
+    const auto* src = reinterpret_cast<const uint8_t*>(weightsMem->GetPtr());
+    const size_t size = OC * IC;
+
+    scales = reinterpret_cast<const float*>(getParentEdgeAt(SCALES_ID)->getMemoryPtr()->GetPtr());
+    const auto* zeroPointsData = reinterpret_cast<const float*>(getParentEdgeAt(ZERO_POINTS_ID)->getMemoryPtr()->GetPtr());
+    zeroPoints.assign(zeroPointsData, zeroPointsData + OC * groups);
+
+    // the weights converted from u4/i4 are packed back to halve the memory traffic
+    bool fitsU4 = true;
+    if (isSigned) {
+        const auto* data = reinterpret_cast<const int8_t*>(src);
+        fitsU4 = std::all_of(data, data + size, [](int8_t v) { return v >= -8 && v <= 7; });
+    } else {
+        fitsU4 = std::all_of(src, src + size, [](uint8_t v) { return v <= 15; });
+    }
+
+    if (!fitsU4) {
+        weightsFormat = isSigned ? WeightsFormat::I8 : WeightsFormat::U8;
+        weightsRowSize = IC;
+        weights = weightsMem;
+        return;
+    }
+
+    weightsFormat = WeightsFormat::U4;
+    weightsRowSize = (IC + 1) / 2;
+    // signed values are stored with +8 offset, the zero points are shifted the same way
+    const uint8_t offset = isSigned ? 8 : 0;
+    if (isSigned) {
+        for (auto& zp : zeroPoints)
+            zp += offset;
+    }
+
+    auto create = [&]() {
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine());
+        ptr->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{OC * weightsRowSize})));
+        auto* dst = reinterpret_cast<uint8_t*>(ptr->GetPtr());
+        parallel_for(OC, [&](size_t oc) {
+            const uint8_t* srcRow = src + oc * IC;
+            uint8_t* dstRow = dst + oc * weightsRowSize;
+            for (size_t i = 0; i < weightsRowSize; i++) {
+                const uint8_t lo = static_cast<uint8_t>(srcRow[2 * i] + offset) & 0xF;
+                const uint8_t hi = 2 * i + 1 < IC ? static_cast<uint8_t>(srcRow[2 * i + 1] + offset) & 0xF : 0;
+                dstRow[i] = static_cast<uint8_t>(lo | (hi << 4));
+            }
+        });
+        return ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_u4"
+                                        + "_" + std::to_string(weightsMem->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(src));
+        weights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        weights = create();
+    }
+}
+
+void FullyConnectedCompressed::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(DATA_ID)->getMemoryPtr()->getStaticDims();
+    batch = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+}
+
+void FullyConnectedCompressed::decompressRow(size_t oc, float* row) const {
+    const size_t groupSize = IC / groups;
+    const auto* data = reinterpret_cast<const uint8_t*>(weights->GetPtr()) + oc * weightsRowSize;
+    for (size_t g = 0; g < groups; g++) {
+        const float scale = scales[oc * groups + g];
+        const float zeroPoint = zeroPoints[oc * groups + g];
+        const size_t begin = g * groupSize;
+        const size_t end = begin + groupSize;
+        switch (weightsFormat) {
+        case WeightsFormat::U8:
+            decompressGroup(data, begin, end, scale, zeroPoint, row);
+            break;
+        case WeightsFormat::I8:
+            decompressGroup(reinterpret_cast<const int8_t*>(data), begin, end, scale, zeroPoint, row);
+            break;
+        case WeightsFormat::U4:
+            decompressGroupU4(data, begin, end, scale, zeroPoint, row);
+            break;
+        }
+    }
+}
+
+MemoryCPtr FullyConnectedCompressed::getDecompressedWeights() {
+    if (decompressedWeights)
+        return decompressedWeights;
+
+    auto create = [&]() {
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine());
+        ptr->Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(VectorDims{OC, IC})));
+        auto* dst = reinterpret_cast<float*>(ptr->GetPtr());
+        parallel_for(OC, [&](size_t oc) {
+            decompressRow(oc, dst + oc * IC);
+        });
+        return ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_f32"
+                                        + "_" + std::to_string(weights->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weights->GetPtr()));
+        decompressedWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        decompressedWeights = create();
+    }
+    return decompressedWeights;
+}
+
+template <typename T>
+void FullyConnectedCompressed::executeImpl() {
+    const auto* src = reinterpret_cast<const T*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    auto* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const float* activations = nullptr;
+    std::vector<float> convertedActivations;
+    if (std::is_same<T, float>::value) {
+        activations = reinterpret_cast<const float*>(src);
+    } else {
+        convertedActivations.resize(batch * IC);
+        cpu_convert(src, convertedActivations.data(), Precision::BF16, Precision::FP32, batch * IC);
+        activations = convertedActivations.data();
+    }
+
+    if (batch > maxDecompressionKernelBatch) {
+        const auto* decompressed = reinterpret_cast<const float*>(getDecompressedWeights()->GetPtr());
+        float* output = reinterpret_cast<float*>(dst);
+        std::vector<float> convertedOutput;
+        if (!std::is_same<T, float>::value) {
+            convertedOutput.resize(batch * OC);
+            output = convertedOutput.data();
+        }
+        // row-major [batch, IC] x [OC, IC]^T
+        const auto status = dnnl_sgemm('N', 'T', batch, OC, IC, 1.f, activations, IC, decompressed, IC, 0.f, output, OC);
+        if (status != dnnl_success)
+            IE_THROW() << "FullyConnectedCompressed node with name '" << getName() << "' failed to execute GEMM";
+        if (!std::is_same<T, float>::value)
+            cpu_convert(output, dst, Precision::FP32, Precision::BF16, batch * OC);
+        return;
+    }
+
+    // Each thread decompresses a block of the weights rows once and multiplies it by all the activations rows,
+    // so the compressed weights are read from memory exactly once per inference
+    constexpr size_t rowsBlock = 4;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(div_up(OC, rowsBlock), nthr, ithr, start, end);
+        std::vector<float> rows(rowsBlock * IC);
+        for (size_t block = start; block < end; block++) {
+            const size_t ocBegin = block * rowsBlock;
+            const size_t ocEnd = std::min(ocBegin + rowsBlock, OC);
+            for (size_t oc = ocBegin; oc < ocEnd; oc++)
+                decompressRow(oc, &rows[(oc - ocBegin) * IC]);
+            for (size_t b = 0; b < batch; b++) {
+                const float* activationsRow = activations + b * IC;
+                for (size_t oc = ocBegin; oc < ocEnd; oc++)
+                    dst[b * OC + oc] = static_cast<T>(dotProduct(activationsRow, &rows[(oc - ocBegin) * IC], IC));
+            }
+        }
+    });
+}
+
+void FullyConnectedCompressed::execute(dnnl::stream strm) {
+    if (getParentEdgeAt(DATA_ID)->getMemoryPtr()->getDesc().getPrecision() == Precision::BF16) {
+        executeImpl<bfloat16_t>();
+    } else {
+        executeImpl<float>();
+    }
+}
+
+void FullyConnectedCompressed::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool FullyConnectedCompressed::created() const {
+    return getType() == Type::FullyConnectedCompressed;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/*
+ * FullyConnected with weight-only compressed u8/i8 weights and per output channel group scales and zero points.
+ * The weights are decompressed row by row inside the kernel, so only the compressed weights are streamed from memory.
+ * The weights which values fit into 4 bits (u4/i4 weights of the original model) are packed by two values per byte.
+ * The row by row decompression pays off for the small batches only (token generation), which are bound by the weights
+ * memory traffic. The large batches (prompt processing) are compute bound, so the weights are decompressed once and
+ * multiplied by the oneDNN GEMM.
+ */
+class FullyConnectedCompressed : public Node {
+public:
+    FullyConnectedCompressed(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    enum class WeightsFormat {
+        U8,
+        I8,
+        U4
+    };
+
+    void prepareWeights();
+    MemoryCPtr getDecompressedWeights();
+    template <typename T>
+    void executeImpl();
+    void decompressRow(size_t oc, float* row) const;
+
+    // the largest batch processed by the row by row decompression kernel
+    static constexpr size_t maxDecompressionKernelBatch = 16;
+
+    static constexpr size_t DATA_ID = 0;
+    static constexpr size_t WEIGHTS_ID = 1;
+    static constexpr size_t SCALES_ID = 2;
+    static constexpr size_t ZERO_POINTS_ID = 3;
+
+    size_t OC = 0;
+    size_t IC = 0;
+    size_t groups = 0;
+    size_t batch = 0;
+
+    WeightsFormat weightsFormat = WeightsFormat::U8;
+    size_t weightsRowSize = 0;
+    MemoryCPtr weights;
+    MemoryCPtr decompressedWeights;
+    const float* scales = nullptr;
+    std::vector<float> zeroPoints;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,165 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum_uni_kernel.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_args_emb_bag_sum, field)
+
+namespace ov {
+namespace intel_cpu {
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_emb_bag_sum_kernel_f32<isa>::jit_uni_emb_bag_sum_kernel_f32(InferenceEngine::Precision tablePrc)
+    : jit_uni_emb_bag_sum_kernel(simd), jit_generator(jit_name()), table_prc(tablePrc), table_type_size(tablePrc.size()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_sum_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_sum_kernel_f32<isa>::generate() {
+    if (table_prc == InferenceEngine::Precision::BF16)
+        uni_vcvtneps2bf16.reset(new jit_uni_vcvtneps2bf16(this, isa));
+
+    this->preamble();
+
+    mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+    mov(reg_row_stride, ptr[reg_params + GET_OFF(row_stride)]);
+    mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+    Xbyak::Label not_weighted_label;
+    Xbyak::Label exit_label;
+
+    test(reg_weights, reg_weights);
+    jz(not_weighted_label, T_NEAR);
+    {
+        loop(unroll, true);
+        loop(1, true);
+        jmp(exit_label, T_NEAR);
+    }
+    L(not_weighted_label);
+    {
+        loop(unroll, false);
+        loop(1, false);
+    }
+    L(exit_label);
+
+    this->postamble();
+
+    if (uni_vcvtneps2bf16)
+        uni_vcvtneps2bf16->emit_data();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_sum_kernel_f32<isa>::loop(size_t vectors, bool weighted) {
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    L(loop_label);
+    {
+        cmp(reg_work_amount, vectors * simd);
+        jl(loop_end_label, T_NEAR);
+
+        accumulate(vectors, weighted);
+
+        add(reg_table, vectors * simd * table_type_size);
+        add(reg_dst, vectors * simd * table_type_size);
+        sub(reg_work_amount, vectors * simd);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_sum_kernel_f32<isa>::accumulate(size_t vectors, bool weighted) {
+    Xbyak::Label indices_loop_label;
+    Xbyak::Label indices_loop_end_label;
+    Xbyak::Label no_prefetch_label;
+
+    for (size_t v = 0; v < vectors; v++)
+        uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+
+    mov(reg_index_ptr, reg_indices);
+    mov(reg_weight_ptr, reg_weights);
+    mov(reg_counter, reg_indices_num);
+
+    L(indices_loop_label);
+    {
+        test(reg_counter, reg_counter);
+        jz(indices_loop_end_label, T_NEAR);
+
+        movsxd(reg_offset, dword[reg_index_ptr]);
+        imul(reg_offset, reg_row_stride);
+
+        // the rows are spread over the table, so the hardware prefetcher can't predict them
+        cmp(reg_counter, prefetch_distance);
+        jle(no_prefetch_label, T_NEAR);
+        {
+            movsxd(reg_prefetch_offset, dword[reg_index_ptr + prefetch_distance * sizeof(int)]);
+            imul(reg_prefetch_offset, reg_row_stride);
+            for (size_t v = 0; v < vectors; v++)
+                prefetcht0(ptr[reg_table + reg_prefetch_offset + v * simd * table_type_size]);
+        }
+        L(no_prefetch_label);
+
+        if (weighted)
+            uni_vbroadcastss(vmm_weight, ptr[reg_weight_ptr]);
+        for (size_t v = 0; v < vectors; v++) {
+            load(vmm_src, ptr[reg_table + reg_offset + v * simd * table_type_size]);
+            if (weighted)
+                uni_vfmadd231ps(Vmm(v), vmm_src, vmm_weight);
+            else
+                uni_vaddps(Vmm(v), Vmm(v), vmm_src);
+        }
+
+        add(reg_index_ptr, sizeof(int));
+        if (weighted)
+            add(reg_weight_ptr, sizeof(float));
+        dec(reg_counter);
+        jmp(indices_loop_label, T_NEAR);
+    }
+    L(indices_loop_end_label);
+
+    for (size_t v = 0; v < vectors; v++)
+        store(ptr[reg_dst + v * simd * table_type_size], Vmm(v));
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_sum_kernel_f32<isa>::load(const Vmm& vmm, const Xbyak::Address& addr) {
+    if (table_prc == InferenceEngine::Precision::BF16) {
+        // bf16 is the upper half of f32
+        vpmovzxwd(vmm, addr);
+        vpslld(vmm, vmm, 16);
+    } else {
+        uni_vmovups(vmm, addr);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_sum_kernel_f32<isa>::store(const Xbyak::Address& addr, const Vmm& vmm) {
+    if (table_prc == InferenceEngine::Precision::BF16) {
+        // the bf16 tables are processed with avx512_core only, so the converted vector fits a ymm register
+        Xbyak::Ymm ymm = Xbyak::Ymm(vmm.getIdx());
+        uni_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(ymm.getIdx())});
+        vmovdqu16(addr, ymm);
+    } else {
+        uni_vmovups(addr, vmm);
+    }
+}
+
+template struct jit_uni_emb_bag_sum_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_emb_bag_sum_kernel_f32<cpu::x64::avx512_core>;
+
+}  // namespace intel_cpu
+}  // namespace ov
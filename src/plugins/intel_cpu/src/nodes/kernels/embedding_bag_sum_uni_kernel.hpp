@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <ie_precision.hpp>
+#include "emitters/jit_bf16_emitters.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_args_emb_bag_sum {
+    const uint8_t* table;   // first element of the processed columns in the table
+    const int* indices;     // indices of the bag
+    const float* weights;   // per sample weights of the bag, nullptr if the bag isn't weighted
+    uint8_t* dst;           // the sums in the precision of the table
+
+    size_t indices_num;
+    size_t row_stride;      // in bytes
+    size_t work_amount;     // number of the columns, multiple of the vector length
+};
+
+struct jit_uni_emb_bag_sum_kernel {
+    void (*ker_)(const jit_args_emb_bag_sum*);
+
+    void operator()(const jit_args_emb_bag_sum* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_sum_kernel(size_t vectorSize) : ker_(nullptr), vector_size(vectorSize) {}
+    virtual ~jit_uni_emb_bag_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    // number of the columns processed by one vector register
+    const size_t vector_size;
+};
+
+// Sums the weighted table rows of the bag for f32 or bf16 tables, the rows are accumulated in f32 and the sums are
+// stored in the precision of the table. The rows of the next indices are prefetched while the current one is accumulated.
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_emb_bag_sum_kernel_f32 : public jit_uni_emb_bag_sum_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_sum_kernel_f32)
+
+    explicit jit_uni_emb_bag_sum_kernel_f32(InferenceEngine::Precision tablePrc);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static constexpr size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    static constexpr size_t simd = vlen / sizeof(float);
+    static constexpr size_t unroll = 4;
+    static constexpr size_t prefetch_distance = 4;
+
+    void loop(size_t vectors, bool weighted);
+    void accumulate(size_t vectors, bool weighted);
+    void load(const Vmm& vmm, const Xbyak::Address& addr);
+    void store(const Xbyak::Address& addr, const Vmm& vmm);
+
+    InferenceEngine::Precision table_prc;
+    size_t table_type_size;
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_row_stride = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_index_ptr = r15;
+    Xbyak::Reg64 reg_weight_ptr = rax;
+    Xbyak::Reg64 reg_counter = rbx;
+    Xbyak::Reg64 reg_offset = rdx;
+    Xbyak::Reg64 reg_prefetch_offset = rsi;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_src = Vmm(unroll);
+    Vmm vmm_weight = Vmm(unroll + 1);
+
+    std::unique_ptr<jit_uni_vcvtneps2bf16> uni_vcvtneps2bf16;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooling_uni_kernel.hpp"
+
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(PoolingKernelExecArgs, field)
+
+template <x64::cpu_isa_t isa>
+PoolingKernel<isa>::PoolingKernel(const PoolingKernelConfParams& jcp) :
+        PoolingKernelBase(jit_name(), jcp) {
+    vlen = x64::cpu_isa_traits<isa>::vlen;
+    dataElPerVec = vlen / sizeof(float);
+    if (jcp.dataPrc == InferenceEngine::Precision::BF16 && isa != x64::avx512_core)
+        IE_THROW() << "Pooling kernel supports bf16 data with avx512_core only.";
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::create_ker() {
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create Pooling kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::generate() {
+    if (jcp.dataPrc == InferenceEngine::Precision::BF16)
+        uni_vcvtneps2bf16.reset(new jit_uni_vcvtneps2bf16(this, isa));
+
+    this->preamble();
+    registersPool = RegistersPool::create(isa, {rax, rcx, rsp, rdi, k0});
+
+    regSrc = getReg64();
+    regDst = getReg64();
+    regWorkAmount = getReg64();
+
+    mov(regSrc, ptr[regParams + GET_OFF(src)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regWorkAmount, ptr[regParams + GET_OFF(workAmount)]);
+    if (jcp.withIndices) {
+        regIndices = getReg64();
+        mov(regIndices, ptr[regParams + GET_OFF(indices)]);
+    }
+
+    if (jcp.algorithm == PoolingKernelAlgorithm::AVG) {
+        auto rAux = getReg64();
+        vAvgScale = getVmm();
+        mov(rAux, ptr[regParams + GET_OFF(avgScale)]);
+        uni_vbroadcastss(vAvgScale, ptr[rAux]);
+    } else {
+        auto rAux = getReg64();
+        Xbyak::Reg32 r32Aux(rAux.getIdx());
+        vLowest = getVmm();
+        mov(r32Aux, 0xff7fffff);  // std::numeric_limits<float>::lowest()
+        vmovd(Xbyak::Xmm(vLowest.getIdx()), r32Aux);
+        vbroadcastss(vLowest, Xbyak::Xmm(vLowest.getIdx()));
+    }
+
+    process();
+
+    registersPool.reset();
+    this->postamble();
+
+    if (uni_vcvtneps2bf16)
+        uni_vcvtneps2bf16->emit_data();
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::process() {
+    Xbyak::Label lLoop, lEnd;
+
+    L(lLoop);
+    {
+        cmp(regWorkAmount, dataElPerVec);
+        jl(lEnd, T_NEAR);
+
+        reduceWindow();
+
+        add(regSrc, dataElPerVec * jcp.dataPrc.size());
+        add(regDst, dataElPerVec * jcp.dataPrc.size());
+        if (jcp.withIndices)
+            add(regIndices, vlen);
+        sub(regWorkAmount, dataElPerVec);
+        jmp(lLoop, T_NEAR);
+    }
+    L(lEnd);
+}
+
+template <>
+void PoolingKernel<x64::avx512_core>::updateMax(const Vmm& vMax, const Vmm& vMaxIdx, const Vmm& vSrc, const Xbyak::Address& idxAddr) {
+    // the strict comparison keeps the first max element of the window like the reference implementation
+    auto kGreater = getMask();
+    auto vIdx = getVmm();
+    vcmpps(kGreater, vMax, vSrc, CMP_LT_PS);
+    vblendmps(vMax | kGreater, vMax, vSrc);
+    vpbroadcastd(vIdx, idxAddr);
+    vpblendmd(vMaxIdx | kGreater, vMaxIdx, vIdx);
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::updateMax(const Vmm& vMax, const Vmm& vMaxIdx, const Vmm& vSrc, const Xbyak::Address& idxAddr) {
+    auto vGreater = getVmm();
+    auto vIdx = getVmm();
+    vcmpps(vGreater, vMax, vSrc, CMP_LT_PS);
+    vblendvps(vMax, vMax, vSrc, vGreater);
+    vpbroadcastd(vIdx, idxAddr);
+    vblendvps(vMaxIdx, vMaxIdx, vIdx, vGreater);
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::reduceWindow() {
+    auto rOffsets = getReg64();
+    auto rCounter = getReg64();
+    auto rOffset = getReg64();
+    auto vAcc = getVmm();
+    auto vSrc = getVmm();
+    RegistersPool::Reg<Xbyak::Reg64> rWinIndices;
+    RegistersPool::Reg<Vmm> vAccIdx;
+
+    mov(rOffsets, ptr[regParams + GET_OFF(windowOffsets)]);
+    mov(rCounter, ptr[regParams + GET_OFF(windowSize)]);
+    if (jcp.algorithm == PoolingKernelAlgorithm::MAX) {
+        uni_vmovups(vAcc, vLowest);
+    } else {
+        uni_vpxor(vAcc, vAcc, vAcc);
+    }
+    if (jcp.withIndices) {
+        rWinIndices = getReg64();
+        vAccIdx = getVmm();
+        mov(rWinIndices, ptr[regParams + GET_OFF(windowIndices)]);
+        uni_vpxor(vAccIdx, vAccIdx, vAccIdx);
+    }
+
+    const Xbyak::Reg64& rSrc = regSrc;
+    const Xbyak::Reg64& rOff = rOffset;
+    Xbyak::Label lWindowLoop, lWindowEnd;
+    L(lWindowLoop);
+    {
+        test(rCounter, rCounter);
+        jz(lWindowEnd, T_NEAR);
+
+        movsxd(rOffset, dword[rOffsets]);
+        load(vSrc, ptr[rSrc + rOff * static_cast<int>(jcp.dataPrc.size())]);
+        if (jcp.algorithm == PoolingKernelAlgorithm::AVG) {
+            uni_vaddps(vAcc, vAcc, vSrc);
+        } else if (jcp.withIndices) {
+            updateMax(vAcc, vAccIdx, vSrc, dword[rWinIndices]);
+            add(rWinIndices, sizeof(int32_t));
+        } else {
+            uni_vmaxps(vAcc, vAcc, vSrc);
+        }
+
+        add(rOffsets, sizeof(int32_t));
+        dec(rCounter);
+        jmp(lWindowLoop, T_NEAR);
+    }
+    L(lWindowEnd);
+
+    if (jcp.algorithm == PoolingKernelAlgorithm::AVG)
+        uni_vmulps(vAcc, vAcc, vAvgScale);
+    store(ptr[regDst], vAcc);
+    if (jcp.withIndices)
+        uni_vmovups(ptr[regIndices], vAccIdx);
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::load(const Vmm& vDst, const Xbyak::Address& srcAddr) {
+    if (jcp.dataPrc == InferenceEngine::Precision::BF16) {
+        // bf16 is the upper half of f32, so the max of the widened values is exact
+        vpmovzxwd(vDst, srcAddr);
+        vpslld(vDst, vDst, 16);
+    } else {
+        uni_vmovups(vDst, srcAddr);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void PoolingKernel<isa>::store(const Xbyak::Address& dstAddr, const Vmm& vSrc) {
+    if (jcp.dataPrc == InferenceEngine::Precision::BF16) {
+        Xbyak::Ymm yDst(vSrc.getIdx());
+        uni_vcvtneps2bf16->emit_code({static_cast<size_t>(vSrc.getIdx())}, {static_cast<size_t>(yDst.getIdx())});
+        vmovdqu16(dstAddr, yDst);
+    } else {
+        uni_vmovups(dstAddr, vSrc);
+    }
+}
+
+template class PoolingKernel<x64::avx512_core>;
+template class PoolingKernel<x64::avx2>;
+
+}   // namespace intel_cpu
+}   // namespace ov
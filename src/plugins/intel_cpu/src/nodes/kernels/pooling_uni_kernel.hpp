@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_kernel_base.hpp"
+#include "emitters/jit_bf16_emitters.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+enum class PoolingKernelAlgorithm { MAX, AVG };
+
+struct PoolingKernelConfParams {
+    PoolingKernelAlgorithm algorithm = PoolingKernelAlgorithm::MAX;
+    // stores the spatial index of the max element of the window, MAX only
+    bool withIndices = false;
+    // FP32 or BF16 (avx512_core only), the bf16 data is reduced in f32 and rounded back on store
+    InferenceEngine::Precision dataPrc = InferenceEngine::Precision::FP32;
+};
+
+/*
+ * The kernel reduces one pooling window for the channels that are contiguous in memory (nspc and blocked layouts).
+ * The window is passed as the list of the offsets of its elements, so any window shape, padding or dilation is supported.
+ */
+struct PoolingKernelExecArgs {
+    const void* src;
+    void* dst;
+    int32_t* indices;
+    const int32_t* windowOffsets;   // offsets of the window elements from src in elements
+    const int32_t* windowIndices;   // spatial indices of the window elements
+    const float* avgScale;          // reciprocal of the averaging area, AVG only
+    uint64_t windowSize = 0lu;
+    uint64_t workAmount = 0lu;      // number of the channels, must be a multiple of the vector length
+};
+
+class PoolingKernelBase: public JitKernelBase {
+public:
+    void (*ker_)(const PoolingKernelExecArgs *);
+    void operator()(const PoolingKernelExecArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit PoolingKernelBase(const char* name, const PoolingKernelConfParams& jcp) : JitKernelBase(name), ker_(nullptr), jcp(jcp) {}
+
+    virtual void create_ker() = 0;
+    uint64_t getDataElPerVec() const {
+        return dataElPerVec;
+    }
+
+protected:
+    PoolingKernelConfParams jcp;
+    uint64_t vlen         = 16lu;
+    uint64_t dataElPerVec = 1lu;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+class PoolingKernel : public PoolingKernelBase {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(PoolingKernel)
+
+    explicit PoolingKernel(const PoolingKernelConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+    using Vmm   = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Zmm, Xbyak::Ymm>::type;
+    using Vmask = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Opmask, Xbyak::Ymm>::type;
+
+private:
+    RegistersPool::Reg<Xbyak::Reg64> regSrc;
+    RegistersPool::Reg<Xbyak::Reg64> regDst;
+    RegistersPool::Reg<Xbyak::Reg64> regIndices;
+    RegistersPool::Reg<Xbyak::Reg64> regWorkAmount;
+
+    const Xbyak::Reg64 regParams = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    RegistersPool::Reg<Vmm> vAvgScale;
+    RegistersPool::Reg<Vmm> vLowest;
+
+    std::unique_ptr<jit_uni_vcvtneps2bf16> uni_vcvtneps2bf16;
+
+    void process();
+    void reduceWindow();
+    void load(const Vmm& vDst, const Xbyak::Address& srcAddr);
+    void store(const Xbyak::Address& dstAddr, const Vmm& vSrc);
+    void updateMax(const Vmm& vMax, const Vmm& vMaxIdx, const Vmm& vSrc, const Xbyak::Address& idxAddr);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -97,6 +97,8 @@ bool Lrn::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, st
                 norm[axis] = true;
             }
 
+            // oneDNN implements both LRN algorithms for all the layouts and for f32/bf16, so no native kernel is needed;
+            // only the reduction over a part of the spatial axes falls back to the reference implementation
             for (size_t i = 2; i < norm.size(); ++i) {
                 if (!norm[i]) {
                     errorMessage = "Supports only across channels or across spatial reduction";
@@ -211,7 +213,7 @@ void Lrn::prepareParams() {
         return std::make_shared<DnnlExecutor>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
     execPtr = result.first;
     if (!execPtr) {
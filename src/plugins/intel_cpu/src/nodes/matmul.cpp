@@ -636,7 +636,7 @@ void MatMul::prepareParams() {
         return std::make_shared<DnnlExecutor>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/box_iou.hpp"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
@@ -153,23 +154,6 @@ static inline float boxArea(const float* bbox, const bool normalized) {
     }
 }
 
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
@@ -194,18 +178,25 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
+    // the sorted candidates in the box_iou layout, so each row of the matrix is computed by the vectorized kernel
+    const size_t stride = originalSize;
+    std::vector<float> candidates(boxIouComponents * stride);
+    const float norm = m_normalized ? 0.f : 1.f;
+    for (size_t j = 0; j < stride; j++) {
+        const float* box = boxesData + candidateIndex[j] * 4;
+        for (size_t k = 0; k < 4; k++)
+            candidates[k * stride + j] = box[k];
+        candidates[4 * stride + j] = boxArea(box, m_normalized);
+    }
+
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (size_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
-        iouMax[actual_index] = max_iou;
+        float box[boxIouComponents];
+        for (size_t k = 0; k < boxIouComponents; k++)
+            box[k] = candidates[k * stride + actual_index];
+        iouMax[actual_index] = XARCH::box_iou(box, candidates.data(), stride, actual_index, IouMode::Overlapped, norm,
+                                              &iouMatrix[actual_index * (actual_index - 1) / 2]);
     });
 
     if (scoresData[candidateIndex[0]] > m_postThreshold) {
@@ -79,6 +79,34 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::setInputNode(Node* node) {
+    inputNode = node;
+    if (auto inputMemoryNode = dynamic_cast<MemoryInput*>(node))
+        inputMemoryNode->setOutputNode(this);
+}
+
+void MemoryOutput::createPrimitive() {
+    // The producer may write the new state directly into the state buffer only if the tensor is not used
+    // by anyone else and is not shared with the other tensors
+    auto parentEdge = getParentEdgeAt(0);
+    auto parent = parentEdge->getParent();
+    canAliasState = inputNode != nullptr &&
+                    parentEdge->getDesc().isCompatible(inputNode->getChildEdgeAt(0)->getMemory().getDesc()) &&
+                    parent->getChildEdges().size() == 1 &&
+                    !one_of(parent->getType(), Type::Input, Type::MemoryInput, Type::Split) &&
+                    !parent->isConstant() && !parent->isInPlace();
+
+    for (size_t i = 0; canAliasState && i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetData() == parentEdge->getMemory().GetData())
+            canAliasState = false;
+    }
+}
+
+void MemoryOutput::assignState(const MemoryPtr& next) {
+    if (canAliasState && next->GetSize() != 0)
+        getParentEdgeAt(0)->getMemoryPtr()->setDataHandle(next->GetData());
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -107,7 +135,8 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
 }
 
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr ctx)
-        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}) {
+        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}),
+          nextStore(new Memory{ctx->getEngine()}) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -121,10 +150,34 @@ void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
     dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    nextStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+
+    // The consumers may read the state buffer directly if none of them modifies or re-shares the tensor.
+    // Same restrictions as for the zero-copy network inputs.
+    canAliasState = true;
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto child = ce->getChild();
+        if (child->isConstant() || child->isInPlace() ||
+            one_of(child->getType(), Type::Output, Type::Split, Type::MemoryOutput)) {
+            canAliasState = false;
+            break;
+        }
+
+        for (size_t i = 0; canAliasState && i < child->getChildEdges().size(); i++) {
+            if (child->getChildEdgeAt(i)->getMemory().GetData() == ce->getMemory().GetData())
+                canAliasState = false;
+        }
+        if (!canAliasState)
+            break;
+    }
 }
 
 /**
@@ -158,18 +211,34 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::assignState(const MemoryPtr& state, const MemoryPtr& next) {
+    dataStore = state;
+    nextStore = next;
+
+    if (canAliasState && dataStore->GetSize() != 0) {
+        for (auto& childEdge : getChildEdges()) {
+            auto ce = childEdge.lock();
+            if (ce)
+                ce->getMemoryPtr()->setDataHandle(dataStore->GetData());
+        }
+    }
+    if (outputNode)
+        outputNode->assignState(nextStore);
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    // The new state is written into the second buffer, so the current one stays valid for the consumers
+    // of the ReadValue node which may be executed after the Assign node.
+    // The copy is skipped if the producer has already written the state into the buffer.
+    if (new_state.GetData() != nextStore->GetData())
+        simple_copy(*nextStore, new_state);
+    std::swap(dataStore, nextStore);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (dstMemory.GetData() != dataStore->GetData())
+        simple_copy(dstMemory, *dataStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -66,21 +66,24 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
 
-    void setInputNode(Node* node) override {
-        inputNode = node;
-    }
+    void setInputNode(Node* node) override;
+    /**
+     * @brief Makes the producer of the new state write directly into the provided buffer if the topology allows
+     */
+    void assignState(const MemoryPtr& next);
 
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
+    bool canAliasState = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -101,10 +104,21 @@ public:
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief Sets the external double buffered state storage. The current state is read from 'state' and
+     * the new one is written into 'next', so the buffers are passed by pointer and no data is copied.
+     */
+    void assignState(const MemoryPtr& state, const MemoryPtr& next);
  private:
     MemoryPtr dataStore;
+    MemoryPtr nextStore;
+    MemoryOutput* outputNode = nullptr;
+    bool canAliasState = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
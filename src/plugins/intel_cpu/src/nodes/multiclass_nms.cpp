@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/box_iou.hpp"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -27,6 +28,33 @@ namespace node {
 
 using ngNmsSortResultType = ov::op::util::MulticlassNmsBase::SortResultType;
 
+namespace {
+
+// the selected boxes are checked in blocks to stop at the first suppressing block
+constexpr size_t iouBlock = 64;
+
+// Stores the box {ymin, xmin, ymax, xmax} to the box_iou layout with the given stride
+inline void storeBox(const float* box, const float norm, float* dst, const size_t stride) {
+    dst[0] = box[0];
+    dst[stride] = box[1];
+    dst[2 * stride] = box[2];
+    dst[3 * stride] = box[3];
+    dst[4 * stride] = (box[2] - box[0] + norm) * (box[3] - box[1] + norm);
+}
+
+// Checks if any of the selected boxes in [begin, end) suppresses the candidate
+inline bool isSuppressed(const float* candidate, const float* selected, const size_t stride, const size_t begin, const size_t end,
+                         const float norm, const float threshold) {
+    for (size_t block = begin; block < end; block += iouBlock) {
+        const size_t num = (std::min)(iouBlock, end - block);
+        if (XARCH::box_iou(candidate, selected + block, stride, num, IouMode::Clamped, norm, nullptr) >= threshold)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
 bool MultiClassNms::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(),
@@ -390,30 +418,6 @@ bool MultiClassNms::created() const {
     return getType() == Type::MulticlassNms;
 }
 
-float MultiClassNms::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
-}
-
 void MultiClassNms::nmsWithEta(const float* boxes,
                                 const float* scores,
                                 const int* roisnum,
@@ -425,9 +429,7 @@ void MultiClassNms::nmsWithEta(const float* boxes,
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
 
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0f : 0.0f;
-    };
+    const float norm = static_cast<float>(m_normalized == false);
 
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (!shared) {
@@ -451,36 +453,28 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = m_iouThreshold;
                 int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                // the selected boxes in the box_iou layout
+                const size_t stride = max_out_box;
+                std::vector<float> selected(boxIouComponents * stride);
+                float candidate[boxIouComponents];
                 while (max_out_box && !sorted_boxes.empty()) {
                     boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
                     sorted_boxes.pop();
                     max_out_box--;
 
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
-                    }
-
-                    currBox.suppress_begin_index = fb.size();
+                    // the hard suppression never decays the score, so the box is either selected or dropped;
+                    // a box with the score at the threshold is compared with the last selected box only to align with ref
+                    size_t begin = currBox.suppress_begin_index;
+                    if (currBox.score <= m_scoreThreshold && fb.size() > begin)
+                        begin = fb.size() - 1;
+                    storeBox(&boxesPtr[currBox.idx * 4], norm, candidate, 1);
+                    const bool box_is_selected = !isSuppressed(candidate, selected.data(), stride, begin, fb.size(), norm, adaptive_threshold);
                     if (box_is_selected) {
                         if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
                             adaptive_threshold *= m_nmsEta;
                         }
-                        if (currBox.score == origScore) {
-                            fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
+                        storeBox(&boxesPtr[currBox.idx * 4], norm, &selected[fb.size()], stride);
+                        fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
                     }
                 }
             }
@@ -532,6 +526,8 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
+    const float norm = static_cast<float>(m_normalized == false);
+
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         /*
         // nms over a class over an image
@@ -564,18 +560,16 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
                 int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                // the selected boxes in the box_iou layout
+                const size_t stride = max_out_box;
+                std::vector<float> selected(boxIouComponents * stride);
+                float candidate[boxIouComponents];
+                storeBox(&boxesPtr[sorted_boxes[0].second * 4], norm, selected.data(), stride);
                 for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
+                    const float* box = &boxesPtr[sorted_boxes[box_idx].second * 4];
+                    storeBox(box, norm, candidate, 1);
+                    if (!isSuppressed(candidate, selected.data(), stride, 0, io_selection_size, norm, m_iouThreshold)) {
+                        storeBox(box, norm, &selected[io_selection_size], stride);
                         m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
                             sorted_boxes[box_idx].second);
                         io_selection_size++;
@@ -7,7 +7,9 @@
 #include "fake_quantize.h"
 #include "conv.h"
 #include "concat.h"
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <string>
 #include <vector>
@@ -17,6 +19,10 @@
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include "ie_parallel.hpp"
+#include "kernels/pooling_uni_kernel.hpp"
+#include "utils/bfloat16.hpp"
 
 // to access and change C pooling primitive desc internal padding field
 #include <common/primitive_desc_iface.hpp>
@@ -24,6 +30,7 @@
 
 using namespace dnnl;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -137,13 +144,36 @@ dnnl::pooling_forward::primitive_desc createDescriptorHelper(const dnnl::engine&
     return desc;
 }
 
+// Strides of the pooling data in [N, channel blocks, D, H, W] form, the channels of one block are contiguous in memory:
+// one channel for ncsp, all the channels for nspc
+struct PoolingDataStrides {
+    size_t block = 1lu;
+    size_t n = 0lu, blk = 0lu, d = 0lu, h = 0lu, w = 0lu;
+};
+
+PoolingDataStrides getDataStrides(const Memory& memory, const VectorDims& dims) {
+    PoolingDataStrides strides;
+    const auto& desc = memory.getDesc();
+    if (desc.hasLayoutType(LayoutType::nspc)) {
+        strides.block = dims[1];
+    } else if (desc.hasLayoutType(LayoutType::nCsp16c) || desc.hasLayoutType(LayoutType::nCsp8c)) {
+        strides.block = memory.GetDescWithType<BlockedMemoryDesc>()->getBlockDims().back();
+    }
+    strides.w = strides.block;
+    strides.h = strides.w * dims[4];
+    strides.d = strides.h * dims[3];
+    strides.blk = strides.d * dims[2];
+    strides.n = strides.blk * div_up(dims[1], strides.block);
+    return strides;
+}
+
 }  // namespace
 
 bool Pooling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (ov::is_type<const ov::op::v8::MaxPool>(op)) {
-            if (!op->get_output_target_inputs(1).empty()) {
-                errorMessage = "MaxPool from opset8 is supported only with one output";
+            if (!op->get_output_target_inputs(1).empty() && op->get_input_partial_shape(0).rank().is_dynamic()) {
+                errorMessage = "MaxPool from opset8 with the indices output doesn't support dynamic rank";
                 return false;
             }
         } else if (!ov::is_type<const ov::op::v1::MaxPool>(op) && !ov::is_type<const ov::op::v1::AvgPool>(op)) {
@@ -181,6 +211,11 @@ Pooling::Pooling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr c
         get_attributes(data_pad_end, maxPoolOp_v8->get_pads_end());
 
         auto_pad = (maxPoolOp_v8->get_auto_pad() == ov::op::PadType::SAME_LOWER || maxPoolOp_v8->get_auto_pad() == ov::op::PadType::SAME_UPPER);
+
+        useNativeImpl = !op->get_output_target_inputs(1).empty();
+        indicesAxis = maxPoolOp_v8->get_axis();
+        if (indicesAxis < 0)
+            indicesAxis += op->get_input_partial_shape(0).rank().get_length();
     } else if (auto maxPoolOp_v1 = ov::as_type_ptr<const ov::op::v1::MaxPool>(op)) {
         algorithm = Algorithm::PoolingMax;
         exclude_pad = false;
@@ -282,6 +317,9 @@ void Pooling::getSupportedDescriptors() {
     if ((inputRank < 3) || (inputRank > 5))
         IE_THROW() << "Pooling layer. Unsupported mode. Only 3D, 4D and 5D blobs are supported as input.";
 
+    if (useNativeImpl)
+        return;
+
     inShape = MemoryDescUtils::makeDummyShape(parentShape);
     if (isDynamicNode()) {
         const auto& origDims = parentShape.getDims();
@@ -335,6 +373,11 @@ void Pooling::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW()  << "Pooling node with name '" << getName() << "' did not set preferable primitive descriptor";
 
+    if (useNativeImpl) {
+        prepareNativeParams();
+        return;
+    }
+
     AttrPtr attr;
     if (isDynamicNode()) {
         if (!pAttr) {
@@ -396,7 +439,7 @@ void Pooling::prepareParams() {
         return std::make_shared<DnnlExecutor>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -421,7 +464,13 @@ void Pooling::prepareParams() {
 }
 
 void Pooling::execute(dnnl::stream strm) {
-    if (execPtr) {
+    if (useNativeImpl) {
+        if (nativePrecision == Precision::BF16) {
+            executeNative<bfloat16_t>();
+        } else {
+            executeNative<float>();
+        }
+    } else if (execPtr) {
         execPtr->exec(primArgs, strm);
     } else {
         IE_THROW() << "Pooling node with name '" << getName() << "' doesn't have an initialized executor";
@@ -510,6 +559,11 @@ void Pooling::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useNativeImpl) {
+        initNativeSupportedPrimitiveDescriptors();
+        return;
+    }
+
     dnnl::primitive_attr attr;
     setPostOps(attr);
 
@@ -537,7 +591,7 @@ void Pooling::initSupportedPrimitiveDescriptors() {
                 config.outConfs.push_back(dataConfig);
             }
 
-            // CPU plugin doesn't support second output of MaxPool-8, but anyway we should have out config for second port as stub
+            // oneDNN doesn't provide the second output of MaxPool-8, it isn't used here, but anyway we should have out config for second port as stub
             if (isMaxPool8) {
                 auto& creatorsMap = BlockedDescCreator::getCommonCreators();
                 PortConfig dataConfig;
@@ -558,6 +612,158 @@ void Pooling::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void Pooling::initNativeSupportedPrimitiveDescriptors() {
+    const auto jitImplType = mayiuse(avx512_core) ? impl_desc_type::jit_avx512 :
+                             mayiuse(avx2) ? impl_desc_type::jit_avx2 : impl_desc_type::ref_any;
+
+    // bf16 is kept in memory and reduced in f32, the max of the widened values and its index are exact
+    nativePrecision = getOriginalInputPrecisionAtPort(0) == Precision::BF16 && mayiuse(avx512_core) ? Precision::BF16 : Precision::FP32;
+
+    // the kernel processes the channels that are contiguous in memory, so the planar layout is executed by reference code
+    std::vector<LayoutType> dataFormats{ LayoutType::ncsp };
+    const auto channels = getInputShapeAtPort(0).getDims()[1];
+    if (channels != 1) {
+        dataFormats.push_back(LayoutType::nspc);
+        dataFormats.push_back(mayiuse(avx512_core) ? LayoutType::nCsp16c : LayoutType::nCsp8c);
+    }
+    for (const auto& df : dataFormats) {
+        addSupportedPrimDesc({{df, nativePrecision}},
+                             {{df, nativePrecision}, {df, Precision::I32}},
+                             df == LayoutType::ncsp ? impl_desc_type::ref_any : jitImplType,
+                             isDynamicNode());
+    }
+}
+
+void Pooling::prepareNativeParams() {
+    if (isDynamicNode() && auto_pad) {
+        data_pad_begin = shapeInference->get_pads_begin();
+        data_pad_end = shapeInference->get_pads_end();
+    }
+
+    if (nativeKernel || getSelectedPrimitiveDescriptor()->getImplementationType() == impl_desc_type::ref_any)
+        return;
+
+    PoolingKernelConfParams jcp;
+    jcp.algorithm = PoolingKernelAlgorithm::MAX;
+    jcp.withIndices = true;
+    jcp.dataPrc = nativePrecision;
+    if (mayiuse(avx512_core)) {
+        nativeKernel.reset(new PoolingKernel<avx512_core>(jcp));
+    } else if (mayiuse(avx2)) {
+        nativeKernel.reset(new PoolingKernel<avx2>(jcp));
+    }
+    if (nativeKernel)
+        nativeKernel->create_ker();
+}
+
+template <typename T>
+void Pooling::executeNative() {
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto& dstMemory = getChildEdgesAtPort(0)[0]->getMemory();
+    const auto* src = reinterpret_cast<const T*>(srcMemory.GetPtr());
+    auto* dst = reinterpret_cast<T*>(dstMemory.GetPtr());
+    auto* indices = reinterpret_cast<int32_t*>(getChildEdgesAtPort(1)[0]->getMemoryPtr()->GetPtr());
+
+    // the spatial dimensions and attributes are extended to 3D
+    auto dimsTo5D = [](const VectorDims& dims) {
+        VectorDims result(5, 1);
+        result[0] = dims[0];
+        result[1] = dims[1];
+        std::copy(dims.begin() + 2, dims.end(), result.end() - (dims.size() - 2));
+        return result;
+    };
+    auto attrTo3D = [](const std::vector<ptrdiff_t>& attr, ptrdiff_t value) {
+        std::vector<ptrdiff_t> result(3, value);
+        std::copy(attr.begin(), attr.end(), result.end() - attr.size());
+        return result;
+    };
+    const auto& origSrcDims = srcMemory.getStaticDims();
+    const auto srcDims = dimsTo5D(origSrcDims);
+    const auto dstDims = dimsTo5D(dstMemory.getStaticDims());
+    const auto kernel3D = attrTo3D(kernel, 1);
+    const auto stride3D = attrTo3D(stride, 1);
+    const auto dilation3D = attrTo3D(dilation, 1);
+    const auto padBegin3D = attrTo3D(data_pad_begin, 0);
+    const auto srcStrides = getDataStrides(srcMemory, srcDims);
+    const auto dstStrides = getDataStrides(dstMemory, dstDims);
+
+    const size_t N = srcDims[0], C = srcDims[1];
+    const ptrdiff_t ID = srcDims[2], IH = srcDims[3], IW = srcDims[4];
+    const size_t OD = dstDims[2], OH = dstDims[3], OW = dstDims[4];
+    const size_t blocksNum = div_up(C, srcStrides.block);
+    const int64_t spatialSize = ID * IH * IW;
+    // the indices are flattened starting from the axis dimension
+    const int64_t indicesRange = std::accumulate(origSrcDims.begin() + indicesAxis, origSrcDims.end(), int64_t(1), std::multiplies<int64_t>());
+    const size_t windowMaxSize = kernel3D[0] * kernel3D[1] * kernel3D[2];
+    const size_t jitStep = nativeKernel ? nativeKernel->getDataElPerVec() : 0lu;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        std::vector<int32_t> windowOffsets(windowMaxSize), windowIndices(windowMaxSize);
+        for_5d(ithr, nthr, N, blocksNum, OD, OH, OW, [&](size_t n, size_t blk, size_t od, size_t oh, size_t ow) {
+            size_t windowSize = 0lu;
+            for (ptrdiff_t kd = 0; kd < kernel3D[0]; kd++) {
+                const ptrdiff_t id = static_cast<ptrdiff_t>(od) * stride3D[0] - padBegin3D[0] + kd * dilation3D[0];
+                if (id < 0 || id >= ID)
+                    continue;
+                for (ptrdiff_t kh = 0; kh < kernel3D[1]; kh++) {
+                    const ptrdiff_t ih = static_cast<ptrdiff_t>(oh) * stride3D[1] - padBegin3D[1] + kh * dilation3D[1];
+                    if (ih < 0 || ih >= IH)
+                        continue;
+                    for (ptrdiff_t kw = 0; kw < kernel3D[2]; kw++) {
+                        const ptrdiff_t iw = static_cast<ptrdiff_t>(ow) * stride3D[2] - padBegin3D[2] + kw * dilation3D[2];
+                        if (iw < 0 || iw >= IW)
+                            continue;
+                        windowOffsets[windowSize] = static_cast<int32_t>(id * srcStrides.d + ih * srcStrides.h + iw * srcStrides.w);
+                        windowIndices[windowSize] = static_cast<int32_t>((id * IH + ih) * IW + iw);
+                        windowSize++;
+                    }
+                }
+            }
+
+            const size_t cStart = blk * srcStrides.block;
+            const size_t cCount = std::min(srcStrides.block, C - cStart);
+            const T* srcData = src + n * srcStrides.n + blk * srcStrides.blk;
+            const size_t dstOffset = n * dstStrides.n + blk * dstStrides.blk + od * dstStrides.d + oh * dstStrides.h + ow * dstStrides.w;
+            T* dstData = dst + dstOffset;
+            int32_t* indicesData = indices + dstOffset;
+
+            size_t c = 0lu;
+            if (jitStep != 0 && cCount >= jitStep) {
+                PoolingKernelExecArgs args;
+                args.src = srcData;
+                args.dst = dstData;
+                args.indices = indicesData;
+                args.windowOffsets = windowOffsets.data();
+                args.windowIndices = windowIndices.data();
+                args.avgScale = nullptr;
+                args.windowSize = windowSize;
+                args.workAmount = cCount - cCount % jitStep;
+                (*nativeKernel)(&args);
+                c = args.workAmount;
+            }
+            for (; c < cCount; c++) {
+                float maxValue = std::numeric_limits<float>::lowest();
+                int32_t maxIndex = 0;
+                for (size_t k = 0lu; k < windowSize; k++) {
+                    const float value = static_cast<float>(srcData[windowOffsets[k] + c]);
+                    if (value > maxValue) {
+                        maxValue = value;
+                        maxIndex = windowIndices[k];
+                    }
+                }
+                dstData[c] = static_cast<T>(maxValue);
+                indicesData[c] = maxIndex;
+            }
+
+            // the spatial indices are converted to the flattened ones
+            for (c = 0lu; c < cCount; c++) {
+                const int64_t flatIndex = static_cast<int64_t>(n * C + cStart + c) * spatialSize + indicesData[c];
+                indicesData[c] = static_cast<int32_t>(flatIndex % indicesRange);
+            }
+        });
+    });
+}
+
 Node::AttrPtr Pooling::initPrimitiveAttr() {
     auto attr = std::make_shared<dnnl::primitive_attr>(dnnl::primitive_attr());
 
@@ -14,6 +14,9 @@
 
 namespace ov {
 namespace intel_cpu {
+
+class PoolingKernelBase;
+
 namespace node {
 
 class Pooling : public Node {
@@ -51,11 +54,23 @@ private:
                                                                    const dnnl::memory::desc& out_candidate,
                                                                    const dnnl::algorithm alg);
 
+    // MaxPool-8 with the indices output is executed by the plugin's own implementation, since oneDNN doesn't provide it.
+    // The other pooling modes (including AvgPool with exclude_pad and the bf16 blocked layouts) are fully covered
+    // by the oneDNN primitives, so only the indices output needs the native path.
+    void initNativeSupportedPrimitiveDescriptors();
+    void prepareNativeParams();
+    template <typename T>
+    void executeNative();
+
     AttrPtr pAttr;
 
     Shape inShape;
 
     bool isMaxPool8 = false;
+    bool useNativeImpl = false;
+    int64_t indicesAxis = 0;
+    InferenceEngine::Precision nativePrecision = InferenceEngine::Precision::FP32;
+    std::shared_ptr<PoolingKernelBase> nativeKernel;
     bool auto_pad = false;
     bool exclude_pad = false;
     std::vector<ptrdiff_t> dilation;
@@ -1075,7 +1075,7 @@ void RNN::prepareParams() {
         return std::make_shared<DnnlExecutor>(descPtr);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -1086,25 +1086,34 @@ void RNN::prepareParams() {
 
     scratchpadMem = getScratchPadMem(execPtr->getScratchPadDesc());
 
-    if (!wasMemoryPrepared || wFormatWasChanged) {
-        auto pd = execPtr->getPrimitiveDesc();
-        auto query_weights_md = [&](int idx = 0) -> dnnl::memory::desc {
-            auto what = dnnl::convert_to_c(dnnl::query::weights_md);
-            const_dnnl_memory_desc_t cdesc = dnnl_primitive_desc_query_md(pd, what, idx);
-            if (!cdesc)
-                IE_THROW() << "query_weights_md failed for node " << getName() << " idx " << idx << ".";
-            dnnl_memory_desc_t cloned_md = nullptr;
-            dnnl_memory_desc_clone(&cloned_md, cdesc);
-
-            return dnnl::memory::desc(cloned_md);
-        };
-        std::vector<DnnlMemoryDescPtr> intDescs {
-            DnnlExtensionUtils::makeDescriptor(query_weights_md(0)),
-            DnnlExtensionUtils::makeDescriptor(query_weights_md(1)),
-            DnnlExtensionUtils::makeDescriptor(query_weights_md(2))
-        };
+    auto pd = execPtr->getPrimitiveDesc();
+    auto query_weights_md = [&](int idx = 0) -> dnnl::memory::desc {
+        auto what = dnnl::convert_to_c(dnnl::query::weights_md);
+        const_dnnl_memory_desc_t cdesc = dnnl_primitive_desc_query_md(pd, what, idx);
+        if (!cdesc)
+            IE_THROW() << "query_weights_md failed for node " << getName() << " idx " << idx << ".";
+        dnnl_memory_desc_t cloned_md = nullptr;
+        dnnl_memory_desc_clone(&cloned_md, cdesc);
+
+        return dnnl::memory::desc(cloned_md);
+    };
+    std::vector<DnnlMemoryDescPtr> intDescs {
+        DnnlExtensionUtils::makeDescriptor(query_weights_md(0)),
+        DnnlExtensionUtils::makeDescriptor(query_weights_md(1)),
+        DnnlExtensionUtils::makeDescriptor(query_weights_md(2))
+    };
+
+    // The primitive may request another weights layout for the new shapes even if wFormat is the same,
+    // so the weights are prepacked once per requested layout and reused by all the following inferences.
+    std::string weightsLayout;
+    for (const auto& desc : intDescs)
+        weightsLayout += desc->serializeFormat() + "_";
+    auto prepared = preparedWeights.find(weightsLayout);
+    if (prepared == preparedWeights.end()) {
         prepareMemory(intDescs);
-        wasMemoryPrepared = true;
+        preparedWeights.emplace(weightsLayout, internalBlobMemory);
+    } else {
+        internalBlobMemory = prepared->second;
     }
 }
 
@@ -9,6 +9,7 @@
 
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "common/dnnl_executor.h"
@@ -143,7 +144,8 @@ private:
     static constexpr size_t optimalBatchSize = 16lu;
     static constexpr size_t batchDimDummyValue = 64lu;
 
-    bool wasMemoryPrepared = false;
+    /** Weights prepacked for the primitive, the key is the weights layout */
+    std::unordered_map<std::string, std::vector<MemoryPtr>> preparedWeights;
     MemoryPtr scratchpadMem;
 
     float inputScale    = 0.f;
@@ -201,7 +201,7 @@ void SoftMax::prepareParams() {
         return std::make_shared<DnnlExecutor>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
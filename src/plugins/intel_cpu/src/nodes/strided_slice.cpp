@@ -11,6 +11,7 @@
 #include <utils/shape_inference/shape_inference_ngraph.hpp>
 #include "slice_shape_inference_utils.hpp"
 
+#include <algorithm>
 #include <string>
 
 using namespace dnnl;
@@ -386,10 +387,140 @@ void StridedSlice::initSupportedPrimitiveDescriptors() {
         config.outConfs[0].setMemDesc(itr->second->createSharedDesc(dataPrecision, getOutputShapeAtPort(DATA_ID)));
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
     }
+
+    // Optimized inplace case: the unit step slice of the planar data is a view on the input memory with the offset
+    // of the first sliced element. The view is created only if it is dense, i.e. the axes after the first sliced one
+    // are kept entirely and the axes before it are unit, since the consumers may read their inputs as contiguous.
+    // The view is static only: the in-place edges are resolved once at the graph compilation.
+    if (isDynamicNode() || !hasConstAttrInputs || !attrs.equalDims || attrs.ellipsisMaskCounter != 0)
+        return;
+
+    const auto& srcShape = getInputShapeAtPort(DATA_ID);
+    const auto& dstShape = getOutputShapeAtPort(0);
+    if (srcShape.hasZeroDims() || dstShape.hasZeroDims() || srcShape.getRank() != dstShape.getRank())
+        return;
+
+    auto tmpAttrs = attrs;
+    addHiddenDims(tmpAttrs, srcShape.getRank(), dstShape.getRank(), isAxesSpecified);
+    const auto& srcDims = srcShape.getStaticDims();
+    const auto& dstDims = dstShape.getStaticDims();
+    VectorDims begin(nDims, 0);
+    for (size_t i = 0; i < nDims; i++) {
+        if (i < tmpAttrs.stride.size() && tmpAttrs.stride[i] != 1)
+            return;
+        if (i < tmpAttrs.begin.size() && tmpAttrs.beginMask[i] != 0) {
+            const int64_t dim = static_cast<int64_t>(srcDims[i]);
+            const int64_t b = tmpAttrs.begin[i] < 0 ? tmpAttrs.begin[i] + dim : tmpAttrs.begin[i];
+            begin[i] = static_cast<size_t>(std::min(std::max<int64_t>(b, 0), dim));
+        }
+        if (begin[i] + dstDims[i] > srcDims[i])
+            return;
+    }
+
+    size_t firstSlicedAxis = 0;
+    while (firstSlicedAxis < nDims && srcDims[firstSlicedAxis] == dstDims[firstSlicedAxis])
+        firstSlicedAxis++;
+    for (size_t i = 0; i < nDims; i++) {
+        if ((i < firstSlicedAxis && dstDims[i] != 1) || (i > firstSlicedAxis && dstDims[i] != srcDims[i]))
+            return;
+    }
+
+    for (const auto& pd : supportedPrimitiveDescriptors) {
+        const auto& refConfig = pd.getConfig();
+        const auto inBlockingDesc = std::dynamic_pointer_cast<CpuBlockedMemoryDesc>(refConfig.inConfs[DATA_ID].getMemDesc());
+        if (!inBlockingDesc || !inBlockingDesc->hasLayoutType(LayoutType::ncsp))
+            continue;
+
+        auto inplaceConfig = refConfig;
+        BlockedMemoryDesc::CmpMask mask = BLOCKED_DESC_SKIP_OFFSET_MASK; // accepts any offset
+        inplaceConfig.inConfs[DATA_ID].setMemDesc(inBlockingDesc, mask);
+        inplaceConfig.outConfs[0].inPlace(DATA_ID);
+        inplaceConfig.outConfs[0].setMemDesc(std::make_shared<CpuBlockedMemoryDesc>(dataPrecision, dstShape, dstDims, inBlockingDesc->getOrder(),
+                                                                                    Shape::UNDEFINED_DIM), mask);
+        supportedPrimitiveDescriptors.emplace_back(inplaceConfig, impl_desc_type::unknown);
+        viewBegin = begin;
+        break;
+    }
+}
+
+void StridedSlice::selectOptimalPrimitiveDescriptor() {
+    // The view is selected only if the data comes in the planar layout, the layout of the parent defines the choice otherwise.
+    // The reference implementation is enforced if it is first in the impl priorities list, this is needed mostly for the testing purposes.
+    const bool isRefEnforced = !implPriorities.empty() && implPriorities[0] == impl_desc_type::ref;
+    const auto parentEdge = getParentEdgeAt(DATA_ID);
+    const auto parentSpd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+    if (!isRefEnforced && parentSpd != nullptr && !parentSpd->getConfig().outConfs.empty()) {
+        int inNum = parentEdge->getInputNum();
+        if (inNum < 0 || inNum >= static_cast<int>(parentSpd->getConfig().outConfs.size()))
+            inNum = 0;
+        const auto& parentPortDesc = parentSpd->getConfig().outConfs[inNum].getPortDesc();
+        for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+            const auto& pd = supportedPrimitiveDescriptors[i];
+            if (pd.getImplementationType() == impl_desc_type::unknown &&
+                pd.getConfig().inConfs[DATA_ID].getPortDesc()->isCompatible(*parentPortDesc)) {
+                selectPrimitiveDescriptorByIndex(static_cast<int>(i));
+                return;
+            }
+        }
+    }
+
+    auto priority = getPrimitivesPriority();
+    priority.erase(std::remove(priority.begin(), priority.end(), impl_desc_type::unknown), priority.end());
+    selectPreferPrimitiveDescriptor(priority, false);
+}
+
+void StridedSlice::initOptimalPrimitiveDescriptor() {
+    if (!isOptimized()) {
+        Node::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    if (isConfigDefined(config))
+        return;
+
+    const auto parentEdge = getParentEdgeAt(DATA_ID);
+    const auto parent = parentEdge->getParent();
+    const int num = parentEdge->getInputNum();
+    bool isParentDescUsed = false;
+    if (parent->getSelectedPrimitiveDescriptor() && num >= 0) {
+        if (!parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs[num].getMemDesc()->isDefined() &&
+            parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs[num].inPlace() >= 0)
+            parent->initOptimalPrimitiveDescriptor();
+        const auto& parentConfig = parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs[num];
+        if (parentConfig.getMemDesc()->isDefined() && config.inConfs[DATA_ID].getPortDesc()->isCompatible(*parentConfig.getPortDesc())) {
+            config.inConfs[DATA_ID].setMemDesc(parentConfig.getMemDesc());
+            isParentDescUsed = true;
+        }
+    }
+    if (!isParentDescUsed) {
+        // reset mask
+        config.inConfs[DATA_ID].setMemDesc(config.inConfs[DATA_ID].getMemDesc());
+    }
+
+    const auto inBlockingDesc = config.inConfs[DATA_ID].getMemDesc()->as<BlockedMemoryDesc>();
+    const auto outBlockingDesc = config.outConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
+    const auto& inStrides = inBlockingDesc->getStrides();
+    size_t offset = inBlockingDesc->getOffsetPadding();
+    for (size_t i = 0; i < viewBegin.size(); i++)
+        offset += viewBegin[i] * inStrides[i];
+
+    config.outConfs[0].setMemDesc(std::make_shared<CpuBlockedMemoryDesc>(outBlockingDesc->getPrecision(),
+                                                                        outBlockingDesc->getShape(),
+                                                                        outBlockingDesc->getBlockDims(),
+                                                                        outBlockingDesc->getOrder(),
+                                                                        offset,
+                                                                        outBlockingDesc->getOffsetPaddingToData(),
+                                                                        outBlockingDesc->getStrides()), BLOCKED_DESC_FULL_MASK);
+    initDescriptor(config);
+}
+
+bool StridedSlice::isOptimized() const {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace() >= 0;
 }
 
 bool StridedSlice::isExecutable() const {
-    return !isInputTensorAtPortEmpty(0) && !isOutputTensorAtPortEmpty(0);
+    return !isInputTensorAtPortEmpty(0) && !isOutputTensorAtPortEmpty(0) && !isOptimized();
 }
 
 void StridedSlice::createPrimitive() {
@@ -426,6 +557,9 @@ bool StridedSlice::needShapeInfer() const {
 }
 
 void StridedSlice::execute(dnnl::stream strm) {
+    if (isOptimized())
+        return;
+
     if (!execPtr)
         IE_THROW() << errorPrefix << "doesn't have compiled executor!";
 
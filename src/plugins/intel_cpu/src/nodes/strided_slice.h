@@ -19,6 +19,8 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
@@ -28,6 +30,7 @@ public:
 
     bool isExecutable() const override;
     bool needShapeInfer() const override;
+    bool isOptimized() const;
 
     struct StridedSliceAttributes {
         std::vector<int> begin;
@@ -128,6 +131,9 @@ private:
     bool shapeHasDataDependency = false;
     bool hasConstAttrInputs = true;
 
+    // the first element of the unit step slice which is the in-place view on the input memory
+    VectorDims viewBegin;
+
     std::vector<MemoryCPtr> srcMemory;
     std::vector<MemoryCPtr> dstMemory;
 
@@ -4,6 +4,8 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -14,6 +16,7 @@
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/reorder_prim.h"
+#include "concat.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace dnnl;
@@ -73,6 +76,64 @@ static std::vector<MemoryPtr> getToMemories(const Node* node, const size_t port)
     return memories;
 }
 
+// The chunks of the outer tensor along the axis are contiguous in memory, so a chunk may be used as a body tensor directly
+static bool isContiguousChunk(const MemoryPtr& full, const MemoryPtr& part, const int axis) {
+    const auto& fullDims = full->getStaticDims();
+    return full->getDesc().hasLayoutType(LayoutType::ncsp) && part->getDesc().hasLayoutType(LayoutType::ncsp) &&
+           full->getDesc().getPrecision() == part->getDesc().getPrecision() &&
+           std::all_of(fullDims.begin(), fullDims.begin() + axis, [](size_t dim) { return dim == 1; });
+}
+
+// The body input may be bound to another memory if its consumers neither write into it in-place
+// nor keep the pointers to it (the same rules as for the graph inputs provided by the user)
+static bool canBindInputMemory(const NodePtr& input) {
+    for (auto& childEdge : input->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            return false;
+
+        auto& child = ce->getChild();
+        if (child->isConstant() || child->isInPlace() || child->getType() == Type::Split)
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e || e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The body output may be bound to another memory if it's produced by a single not in-place node
+// (the same rules as for the graph outputs provided by the user)
+static bool canBindOutputMemory(const NodePtr& output) {
+    auto parentEdge = output->getParentEdgeAt(0);
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getType() == Type::Input || parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (e && e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 static void nullifyUndefinedDims(VectorDims& dims) {
     std::transform(dims.begin(), dims.end(), dims.begin(), [](const size_t& dim) {
         return dim == Shape::UNDEFINED_DIM ? 0 : dim;
@@ -124,6 +185,10 @@ public:
             mem_holder_dst = chunk_mem;
         }
         reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+
+        // the contiguous chunk in the same layout is copied without the reorder
+        if (isContiguousChunk(full_blob, part_blob, axis))
+            plain_copy_size = part_blob->GetSize();
     }
 
     void execute(dnnl::stream strm, int iter) override {
@@ -133,12 +198,17 @@ public:
         chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
                                           chunk_offset_in_byte + chunk_stride_in_byte * iter);
 
-        reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+        if (plain_copy_size != 0) {
+            cpu_memcpy(mem_holder_dst.get_data_handle(), mem_holder_src.get_data_handle(), plain_copy_size);
+        } else {
+            reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+        }
     }
 
 private:
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
+    size_t plain_copy_size = 0lu;
 
     bool sliced_src;
     dnnl::memory full_mem;
@@ -152,13 +222,92 @@ public:
         mem_holder_src = from->GetPrimitive();
         mem_holder_dst = to->GetPrimitive();
         reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        if (mem_holder_src.get_desc() == mem_holder_dst.get_desc())
+            plain_copy_size = mem_holder_src.get_desc().get_size();
     }
 
     void execute(dnnl::stream strm, int iter = -1) override {
         if (iter != 0) {
-            reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+            if (plain_copy_size != 0) {
+                cpu_memcpy(mem_holder_dst.get_data_handle(), mem_holder_src.get_data_handle(), plain_copy_size);
+            } else {
+                reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+            }
         }
     }
+
+private:
+    size_t plain_copy_size = 0lu;
+};
+
+/**
+ * Binds the body memories to the current chunk of the outer tensor,
+ * so the body reads its input from (or writes its output to) the outer tensor without copying
+ */
+class PortInPlaceIteratorHelper : public PortMapHelper {
+public:
+    PortInPlaceIteratorHelper(const MemoryPtr &full, const std::vector<MemoryPtr> &parts, const PortMap &slice_rule)
+                              : full_mem(full), part_mems(parts) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        const auto sign_of_stride = slice_rule.stride < 0 ? -1 : 1;
+
+        iter_count = full->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        chunk_stride_in_byte = part_mems.front()->GetSize();
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &mem : part_mems)
+            mem->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_mem;
+    std::vector<MemoryPtr> part_mems;
+
+    int iter_count;
+};
+
+/**
+ * Passes the body output to the body input of the next iteration by swapping the memories of both
+ * between two buffers instead of copying
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const std::vector<MemoryPtr> &to, const dnnl::engine& eng)
+                       : from_mem(from), to_mems(to) {
+        for (auto &buffer : buffers) {
+            buffer = std::make_shared<Memory>(eng);
+            buffer->Create(from->getDesc());
+        }
+        bind();
+    }
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            std::swap(buffers[0], buffers[1]);
+            bind();
+        }
+    }
+
+private:
+    void bind() {
+        for (auto &mem : to_mems)
+            mem->setDataHandle(buffers[0]->GetData());
+        from_mem->setDataHandle(buffers[1]->GetData());
+    }
+
+    MemoryPtr from_mem;
+    std::vector<MemoryPtr> to_mems;
+    std::array<MemoryPtr, 2> buffers;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -376,6 +525,11 @@ void DynamicBuffer::transfer(const Node* node) {
 }
 
 void DynamicBuffer::copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len) {
+    // a single chunk is copied in place to avoid the threading overhead on every iteration
+    if (count == 1) {
+        cpu_memcpy(dst, src, len);
+        return;
+    }
     parallel_for(count, [&](const size_t i) {
         cpu_memcpy(&dst[i * dst_stride], &src[i * src_stride], len);
     });
@@ -416,6 +570,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -427,6 +582,7 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -547,7 +703,9 @@ void TensorIterator::prepareParams() {
     prepareInitialCond();
 
     first_mappers.clear();
+    last_mappers.clear();
     before_mappers.clear();
+    after_mappers.clear();
     back_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
@@ -558,8 +716,10 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // the back edges read the body outputs of the previous iteration,
+            // so they go before the outputs are bound to the next chunks
             prepareBackEdges();
+            prepareOutputPorts();
         }
 
         // reset local states of DynamicBuffer
@@ -640,6 +800,8 @@ void TensorIterator::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (!isDynamicNode() && isContiguousChunk(from_mem, to_mem, map_rule.axis) && canBindInputMemory(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(std::make_shared<PortInPlaceIteratorHelper>(from_mem, input_mems[map_rule.to], map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -652,20 +814,37 @@ void TensorIterator::prepareOutputPorts() {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
-        else
+        } else if (isContiguousChunk(to_mem, from_mem, map_rule.axis) && canBindOutputMemory(output_nodes[map_rule.to]) &&
+                   std::find(bound_outputs.begin(), bound_outputs.end(), map_rule.to) == bound_outputs.end()) {
+            // the body writes the chunk of the outer tensor directly
+            before_mappers.emplace_back(std::make_shared<PortInPlaceIteratorHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
+            bound_outputs.push_back(map_rule.to);
+        } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
+        }
     }
 }
 
 void TensorIterator::prepareBackEdges() {
     const auto &eng = getEngine();
+    bound_outputs.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        // the output may be swapped with the input only if it isn't passed anywhere else
+        const bool canSwap = from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+                             from_mem->getDnnlMemoryMngr() != to_mem->getDnnlMemoryMngr() &&
+                             std::count_if(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) { return rule.from == map_rule.from; }) == 1 &&
+                             canBindOutputMemory(output_nodes[map_rule.from]) && canBindInputMemory(input_nodes[map_rule.to]);
+        if (canSwap) {
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, input_mems[map_rule.to], eng));
+            bound_outputs.push_back(map_rule.from);
+        } else {
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        }
     }
 }
 
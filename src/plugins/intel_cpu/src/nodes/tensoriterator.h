@@ -143,6 +143,9 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<NodePtr> input_nodes;   /// < body Input nodes in the same order as input_mems
+    std::vector<NodePtr> output_nodes;  /// < body Output nodes in the same order as output_mem
+    std::vector<int> bound_outputs;     /// < body outputs bound to the back edge buffers or to the outer tensors
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
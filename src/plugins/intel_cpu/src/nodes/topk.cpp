@@ -14,6 +14,7 @@
 #include <ngraph/op/topk.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <algorithm>
+#include <cstring>
 
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise.hpp>
@@ -1788,6 +1789,43 @@ private:
     }
 };
 
+namespace {
+
+// the radix selection is used for the rows not shorter than radix_min_axis_dim with top_k not greater than axis_dim / radix_max_k_ratio
+constexpr size_t radix_min_axis_dim = 16384;
+constexpr size_t radix_max_k_ratio = 16;
+constexpr int radix_bits = 11;
+
+// The radix selection compares the unsigned keys which have the same order as the values.
+inline uint32_t radix_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (bits == 0x80000000u)
+        bits = 0u;  // -0.0 is equal to 0.0
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+// bf16 values are processed as raw bits
+inline uint32_t radix_key(uint16_t bits) {
+    if (bits == 0x8000u)
+        bits = 0u;
+    return (bits & 0x8000u) ? (~static_cast<uint32_t>(bits) & 0xFFFFu) : (bits | 0x8000u);
+}
+
+inline uint32_t radix_key(int32_t value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+
+inline uint32_t radix_key(int8_t value) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(value) ^ 0x80u);
+}
+
+inline uint32_t radix_key(uint8_t value) {
+    return value;
+}
+
+}  // namespace
+
 bool TopK::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), ov::op::v1::TopK::get_type_info_static(),
@@ -2052,6 +2090,14 @@ void TopK::prepareParams() {
             }
         }
 
+        // [case 0]: if topk is imposed on innermost dimension of planar(ncsp/nspc) layout and the rows are too few to occupy
+        //           all the threads, the single threaded kernel per row is replaced by radix selection, which splits the long
+        //           (e.g. vocabulary sized) rows between the threads. The selection is O(N) and keeps the order of the stable sorting.
+        const size_t nthr = parallel_get_max_threads();
+        radix_select = (layout == TopKLayoutType::topk_ncsp || layout == TopKLayoutType::topk_nspc) && topk_innermost &&
+                       nthr > 1 && O < nthr && top_k > 0 && axis_dim >= radix_min_axis_dim &&
+                       static_cast<size_t>(top_k) * radix_max_k_ratio <= axis_dim;
+
         prepare_original_idx();
     } else { //reference mode
         int j;
@@ -2138,7 +2184,10 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_idx = reinterpret_cast<uint8_t *>(dstIndexesMemPtr->GetPtr());
 
     if (jit_mode) {
-        topk_process(src_data, dst_data, dst_idx);
+        if (radix_select)
+            topk_radix_process(src_data, dst_data, dst_idx);
+        else
+            topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
             auto in_ptr = reinterpret_cast<const float *>(src_data);
@@ -2204,6 +2253,122 @@ void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_id
     }
 }
 
+void TopK::topk_radix_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    auto out_idx = reinterpret_cast<int32_t *>(out_idx_ptr);
+    const auto precision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision();
+    switch (precision) {
+        case Precision::FP32:
+            topk_radix_select(reinterpret_cast<const float *>(in_ptr), reinterpret_cast<float *>(out_ptr), out_idx);
+            break;
+        case Precision::BF16:
+            topk_radix_select(reinterpret_cast<const uint16_t *>(in_ptr), reinterpret_cast<uint16_t *>(out_ptr), out_idx);
+            break;
+        case Precision::I32:
+            topk_radix_select(reinterpret_cast<const int32_t *>(in_ptr), reinterpret_cast<int32_t *>(out_ptr), out_idx);
+            break;
+        case Precision::I8:
+            topk_radix_select(reinterpret_cast<const int8_t *>(in_ptr), reinterpret_cast<int8_t *>(out_ptr), out_idx);
+            break;
+        case Precision::U8:
+            topk_radix_select(reinterpret_cast<const uint8_t *>(in_ptr), out_ptr, out_idx);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " doesn't support radix selection for precision " << precision.name();
+    }
+}
+
+// Radix selection of the row: the key of the k-th element is found bucket by bucket starting from the highest bits,
+// each pass builds the histogram of the next bits of the keys in the current bucket. The histograms and the gathering
+// of the selected elements split the row between the threads. The lower bits are skipped once the bucket is small.
+template <typename T>
+void TopK::topk_radix_select(const T *in_ptr, T *out_ptr, int32_t *out_idx_ptr) {
+    using candidate = std::pair<uint32_t, int32_t>;  // {key, index}
+    constexpr int key_bits = static_cast<int>(sizeof(T) * 8);
+    const uint32_t key_mask = key_bits == 32 ? 0xFFFFFFFFu : ((1u << key_bits) - 1u);
+    // max topk selects the smallest inverted keys
+    const uint32_t key_flip = mode_max ? key_mask : 0u;
+    const size_t k = static_cast<size_t>(top_k);
+    const int nthreads = parallel_get_max_threads();
+
+    std::vector<size_t> histograms(static_cast<size_t>(nthreads) << radix_bits);
+    std::vector<std::vector<candidate>> thread_candidates(nthreads);
+    std::vector<candidate> candidates;
+
+    for (size_t o = 0; o < O; o++) {
+        const T *src = in_ptr + o * axis_dim;
+
+        uint32_t prefix = 0u, prefix_mask = 0u;
+        size_t remaining = k;
+        int shift = key_bits;
+        while (shift > 0) {
+            const int bits = std::min(radix_bits, shift);
+            shift -= bits;
+            const size_t buckets = static_cast<size_t>(1) << bits;
+
+            std::fill(histograms.begin(), histograms.end(), 0);
+            parallel_nt(nthreads, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(axis_dim, nthr, ithr, start, end);
+                size_t *hist = &histograms[static_cast<size_t>(ithr) << radix_bits];
+                for (size_t a = start; a < end; a++) {
+                    const uint32_t key = radix_key(src[a]) ^ key_flip;
+                    if ((key & prefix_mask) == prefix)
+                        hist[(key >> shift) & (buckets - 1)]++;
+                }
+            });
+
+            size_t bucket = 0, bucket_count = 0;
+            for (; bucket < buckets; bucket++) {
+                bucket_count = 0;
+                for (int t = 0; t < nthreads; t++)
+                    bucket_count += histograms[(static_cast<size_t>(t) << radix_bits) + bucket];
+                if (remaining <= bucket_count || bucket == buckets - 1)
+                    break;
+                remaining -= bucket_count;
+            }
+            prefix |= static_cast<uint32_t>(bucket) << shift;
+            prefix_mask |= static_cast<uint32_t>(buckets - 1) << shift;
+            if (bucket_count <= buckets)
+                break;
+        }
+
+        // all the keys up to the bucket of the k-th key are gathered in the order of the indices
+        const uint32_t upper = prefix | (~prefix_mask & key_mask);
+        parallel_nt(nthreads, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(axis_dim, nthr, ithr, start, end);
+            auto &local = thread_candidates[ithr];
+            for (size_t a = start; a < end; a++) {
+                const uint32_t key = radix_key(src[a]) ^ key_flip;
+                if (key <= upper)
+                    local.emplace_back(key, static_cast<int32_t>(a));
+            }
+        });
+        candidates.clear();
+        for (auto &local : thread_candidates) {
+            candidates.insert(candidates.end(), local.begin(), local.end());
+            local.clear();
+        }
+
+        // the equal keys are ordered by the indices, so the result matches the stable sorting
+        if (candidates.size() > k)
+            std::nth_element(candidates.begin(), candidates.begin() + k, candidates.end());
+        if (sort_index) {
+            std::sort(candidates.begin(), candidates.begin() + k,
+                      [](const candidate &lhs, const candidate &rhs) { return lhs.second < rhs.second; });
+        } else {
+            std::sort(candidates.begin(), candidates.begin() + k);
+        }
+
+        T *dst = out_ptr + o * k;
+        int32_t *dst_idx = out_idx_ptr + o * k;
+        for (size_t j = 0; j < k; j++) {
+            dst_idx[j] = candidates[j].second;
+            dst[j] = src[candidates[j].second];
+        }
+    }
+}
+
 inline void TopK::topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
                                                 uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount) {
     auto arg = jit_topk_call_args();
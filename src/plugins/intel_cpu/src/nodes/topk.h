@@ -101,6 +101,9 @@ public:
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
+    void topk_radix_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr);
+    template <typename T>
+    void topk_radix_select(const T *in_ptr, T *out_ptr, int32_t *out_idx_ptr);
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
     inline static int count(const VectorDims& dims, size_t start_ind, size_t end_ind);
@@ -129,6 +132,7 @@ private:
     int top_k;
     int dim, before_num;
     bool bubble_inplace;
+    bool radix_select = false; // the rows are split between the threads by the radix selection instead of the jit kernel
     bool preset_params_done;
 
     VectorDims src_dims, dst_dims;
@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <string>
 #include <vector>
 
 #include "unique.hpp"
+#include "ie_parallel.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -162,120 +164,302 @@ void Unique::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+namespace {
+// Maps the values to unsigned keys that keep their order, so the values can be radix sorted.
+// Positive and negative zeros are mapped to the same key as they are equal.
+template <typename T>
+struct UniqueKey;
+
+template <>
+struct UniqueKey<float> {
+    using type = uint32_t;
+    static type get(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        if (bits == 0x80000000u)
+            bits = 0u;
+        return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    }
+};
+
+template <>
+struct UniqueKey<int32_t> {
+    using type = uint32_t;
+    static type get(int32_t value) {
+        return static_cast<uint32_t>(value) ^ 0x80000000u;
+    }
+};
+
+template <>
+struct UniqueKey<int8_t> {
+    using type = uint8_t;
+    static type get(int8_t value) {
+        return static_cast<uint8_t>(value) ^ 0x80u;
+    }
+};
+
+template <>
+struct UniqueKey<uint8_t> {
+    using type = uint8_t;
+    static type get(uint8_t value) {
+        return value;
+    }
+};
+
+// The input is processed by chunks of at least this size, so the small tensors are processed sequentially.
+constexpr size_t minChunkLen = 16384lu;
+
+inline size_t getChunksNum(size_t len) {
+    return std::max(std::min(static_cast<size_t>(parallel_get_max_threads()), len / minChunkLen), size_t(1));
+}
+
+// Fibonacci hashing: the high bits of the product are used as the slot index
+inline uint64_t hashKey(uint32_t key) {
+    return static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+}
+
+// Returns the exclusive prefix sums of the per chunk counters and their total sum.
+inline size_t exclusivePrefixSum(std::vector<size_t>& counters) {
+    size_t sum = 0lu;
+    for (auto& counter : counters) {
+        const auto count = counter;
+        counter = sum;
+        sum += count;
+    }
+    return sum;
+}
+}   // namespace
+
 template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetPtr());
     const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetSize() / sizeof(T);
     std::vector<T> uniDataTmp(inputLen);
     auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
+
+    if (sorted) {
+        flattenSortedExec(srcDataPtr, inputLen, uniDataTmpPtr);
+    } else {
+        flattenHashExec(srcDataPtr, inputLen, uniDataTmpPtr);
+    }
+
+    redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
+
+    T* uniDataPtr = reinterpret_cast<T*>(getChildEdgesAtPort(UNIQUE_DATA)[0]->getMemoryPtr()->GetPtr());
+    memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
     if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
+        int *firstPtr = reinterpret_cast<int*>(getChildEdgesAtPort(FIRST_UNIQUE_IDX)[0]->getMemoryPtr()->GetPtr());
+        memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
     }
     if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
+        auto inToOutPtr = reinterpret_cast<int*>(getChildEdgesAtPort(INPUT_TO_UNIQ_IDX)[0]->getMemoryPtr()->GetPtr());
+        memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
     }
     if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
+        auto occurPtr = reinterpret_cast<int*>(getChildEdgesAtPort(OCCURRENCES_NUM)[0]->getMemoryPtr()->GetPtr());
+        memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
     }
-    uniqueLen = inputLen;
+}
 
-    if (sorted) {
-        std::memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
+/*
+ * The values are sorted together with their indices by the parallel LSD radix sort. The sort is stable, so the first
+ * element of each run of equal values is the first occurrence of the value in the input.
+ */
+template <typename T>
+void Unique::flattenSortedExec(const T* srcDataPtr, size_t inputLen, T* uniDataTmpPtr) {
+    using Key = typename UniqueKey<T>::type;
+    constexpr size_t radixBits = 8lu;
+    constexpr size_t radixSize = 1lu << radixBits;
+
+    const size_t chunksNum = getChunksNum(inputLen);
+    std::vector<Key> keys(inputLen), keysTmp(inputLen);
+    std::vector<int32_t> idx(inputLen), idxTmp(inputLen);
+    parallel_for(chunksNum, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, chunk, start, end);
+        for (size_t i = start; i < end; i++) {
+            keys[i] = UniqueKey<T>::get(srcDataPtr[i]);
+            idx[i] = static_cast<int32_t>(i);
         }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (int j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
+    });
+
+    std::vector<size_t> histograms(chunksNum * radixSize);
+    for (size_t shift = 0lu; shift < sizeof(Key) * 8lu; shift += radixBits) {
+        std::fill(histograms.begin(), histograms.end(), 0lu);
+        parallel_for(chunksNum, [&](size_t chunk) {
+            size_t start = 0lu, end = 0lu;
+            splitter(inputLen, chunksNum, chunk, start, end);
+            size_t* histogram = &histograms[chunk * radixSize];
+            for (size_t i = start; i < end; i++) {
+                histogram[(keys[i] >> shift) & (radixSize - 1)]++;
             }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (int j = 0; j < uniqueLen; j++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
+        });
+
+        // the pass is skipped if all the keys have the same digit, e.g. the high bytes of the small ids
+        bool sameDigit = false;
+        for (size_t d = 0lu; d < radixSize && !sameDigit; d++) {
+            size_t count = 0lu;
+            for (size_t chunk = 0lu; chunk < chunksNum; chunk++) {
+                count += histograms[chunk * radixSize + d];
             }
+            sameDigit = count == inputLen;
         }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
+        if (sameDigit)
+            continue;
+
+        // the destination of the digit d of the chunk c follows all the smaller digits and the digit d of the previous chunks
+        size_t offset = 0lu;
+        for (size_t d = 0lu; d < radixSize; d++) {
+            for (size_t chunk = 0lu; chunk < chunksNum; chunk++) {
+                const auto count = histograms[chunk * radixSize + d];
+                histograms[chunk * radixSize + d] = offset;
+                offset += count;
+            }
         }
-        uniqueLen = 1;
-
-        for (int i = 1; i < inputLen; i++) {
-            bool found = false;
-            int j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
+
+        parallel_for(chunksNum, [&](size_t chunk) {
+            size_t start = 0lu, end = 0lu;
+            splitter(inputLen, chunksNum, chunk, start, end);
+            size_t* offsets = &histograms[chunk * radixSize];
+            for (size_t i = start; i < end; i++) {
+                const auto dst = offsets[(keys[i] >> shift) & (radixSize - 1)]++;
+                keysTmp[dst] = keys[i];
+                idxTmp[dst] = idx[i];
             }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
+        });
+        keys.swap(keysTmp);
+        idx.swap(idxTmp);
+    }
+
+    // the unique values are numbered by the runs of the equal keys
+    std::vector<size_t> runsOffsets(chunksNum, 0lu);
+    parallel_for(chunksNum, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, chunk, start, end);
+        for (size_t i = start; i < end; i++) {
+            if (i == 0 || keys[i] != keys[i - 1])
+                runsOffsets[chunk]++;
+        }
+    });
+    uniqueLen = exclusivePrefixSum(runsOffsets);
+
+    std::vector<size_t> runsStarts(uniqueLen + 1, inputLen);
+    parallel_for(chunksNum, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, chunk, start, end);
+        int32_t run = static_cast<int32_t>(runsOffsets[chunk]) - 1;
+        for (size_t i = start; i < end; i++) {
+            if (i == 0 || keys[i] != keys[i - 1]) {
+                run++;
+                runsStarts[run] = i;
+                uniDataTmpPtr[run] = srcDataPtr[idx[i]];
                 if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
+                    firstUniTmp[run] = idx[i];
                 }
             }
             if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
+                inToOutTmp[idx[i]] = run;
             }
         }
+    });
+
+    if (definedOutputs[OCCURRENCES_NUM]) {
+        parallel_for(uniqueLen, [&](size_t run) {
+            occurTmp[run] = static_cast<int32_t>(runsStarts[run + 1] - runsStarts[run]);
+        });
     }
+}
 
-    redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
+/*
+ * The unique values are collected in the open addressing hash table filled concurrently. Each slot keeps the smallest
+ * index of its value, so the unique values are numbered in the order of their first occurrence like in the sequential
+ * algorithm.
+ */
+template <typename T>
+void Unique::flattenHashExec(const T* srcDataPtr, size_t inputLen, T* uniDataTmpPtr) {
+    constexpr int32_t emptySlot = -1;
+    // the table is kept at most half full to keep the probe sequences short
+    size_t capacityBits = 4lu;
+    while ((size_t(1) << capacityBits) < 2 * inputLen) {
+        capacityBits++;
+    }
+    const size_t capacity = size_t(1) << capacityBits;
+    const size_t mask = capacity - 1;
+    const size_t hashShift = 64lu - capacityBits;
+
+    const size_t chunksNum = getChunksNum(inputLen);
+    std::vector<std::atomic<int32_t>> table(capacity);
+    std::vector<std::atomic<int32_t>> slotsOccur(definedOutputs[OCCURRENCES_NUM] ? capacity : 0lu);
+    parallel_for(capacity, [&](size_t slot) {
+        table[slot].store(emptySlot, std::memory_order_relaxed);
+        if (!slotsOccur.empty())
+            slotsOccur[slot].store(0, std::memory_order_relaxed);
+    });
+
+    std::vector<int32_t> slotOf(inputLen);
+    parallel_for(chunksNum, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, chunk, start, end);
+        for (size_t i = start; i < end; i++) {
+            const auto value = srcDataPtr[i];
+            const auto index = static_cast<int32_t>(i);
+            size_t slot = static_cast<size_t>(hashKey(UniqueKey<T>::get(value)) >> hashShift);
+            while (true) {
+                int32_t current = table[slot].load(std::memory_order_acquire);
+                if (current == emptySlot && table[slot].compare_exchange_strong(current, index, std::memory_order_acq_rel))
+                    break;
+                // the slot is taken: either by the same value or by a colliding one
+                if (srcDataPtr[current] == value) {
+                    while (index < current &&
+                           !table[slot].compare_exchange_weak(current, index, std::memory_order_acq_rel)) {}
+                    break;
+                }
+                slot = (slot + 1) & mask;
+            }
+            slotOf[i] = static_cast<int32_t>(slot);
+            if (!slotsOccur.empty())
+                slotsOccur[slot].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<size_t> uniqueOffsets(chunksNum, 0lu);
+    parallel_for(chunksNum, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, chunk, start, end);
+        for (size_t i = start; i < end; i++) {
+            if (table[slotOf[i]].load(std::memory_order_relaxed) == static_cast<int32_t>(i))
+                uniqueOffsets[chunk]++;
+        }
+    });
+    uniqueLen = exclusivePrefixSum(uniqueOffsets);
+
+    std::vector<int32_t> slotsUnique(definedOutputs[INPUT_TO_UNIQ_IDX] ? capacity : 0lu);
+    parallel_for(chunksNum, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, chunk, start, end);
+        auto unique = uniqueOffsets[chunk];
+        for (size_t i = start; i < end; i++) {
+            const auto slot = slotOf[i];
+            if (table[slot].load(std::memory_order_relaxed) != static_cast<int32_t>(i))
+                continue;
+            uniDataTmpPtr[unique] = srcDataPtr[i];
+            if (definedOutputs[FIRST_UNIQUE_IDX]) {
+                firstUniTmp[unique] = static_cast<int32_t>(i);
+            }
+            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+                slotsUnique[slot] = static_cast<int32_t>(unique);
+            }
+            if (definedOutputs[OCCURRENCES_NUM]) {
+                occurTmp[unique] = slotsOccur[slot].load(std::memory_order_relaxed);
+            }
+            unique++;
+        }
+    });
 
-    T* uniDataPtr = reinterpret_cast<T*>(getChildEdgesAtPort(UNIQUE_DATA)[0]->getMemoryPtr()->GetPtr());
-    memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        int *firstPtr = reinterpret_cast<int*>(getChildEdgesAtPort(FIRST_UNIQUE_IDX)[0]->getMemoryPtr()->GetPtr());
-        memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
-    }
     if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        auto inToOutPtr = reinterpret_cast<int*>(getChildEdgesAtPort(INPUT_TO_UNIQ_IDX)[0]->getMemoryPtr()->GetPtr());
-        memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        auto occurPtr = reinterpret_cast<int*>(getChildEdgesAtPort(OCCURRENCES_NUM)[0]->getMemoryPtr()->GetPtr());
-        memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
+        parallel_for(inputLen, [&](size_t i) {
+            inToOutTmp[i] = slotsUnique[slotOf[i]];
+        });
     }
 }
 
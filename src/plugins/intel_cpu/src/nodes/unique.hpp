@@ -34,6 +34,10 @@ private:
     template <typename T>
     void flattenTensorExec();
     template <typename T>
+    void flattenSortedExec(const T* srcDataPtr, size_t inputLen, T* uniDataTmpPtr);
+    template <typename T>
+    void flattenHashExec(const T* srcDataPtr, size_t inputLen, T* uniDataTmpPtr);
+    template <typename T>
     void slicedTensorExec();
 
     template<typename T>
@@ -40,6 +40,7 @@
 #include "nodes/proposal.h"
 #include "nodes/tensoriterator.h"
 #include "nodes/fullyconnected.h"
+#include "nodes/fullyconnected_compressed.h"
 #include "nodes/extract_image_patches.h"
 #include "nodes/ctc_loss.h"
 #include "nodes/reorder.h"
@@ -132,6 +133,7 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(GatherTree, Type::GatherTree);
     INTEL_CPU_NODE(SpaceToDepth, Type::SpaceToDepth);
     INTEL_CPU_NODE(FullyConnected, Type::FullyConnected);
+    INTEL_CPU_NODE(FullyConnectedCompressed, Type::FullyConnectedCompressed);
     INTEL_CPU_NODE(CTCGreedyDecoder, Type::CTCGreedyDecoder);
     INTEL_CPU_NODE(Transpose, Type::Transpose);
     INTEL_CPU_NODE(DeformableConvolution, Type::DeformableConvolution);
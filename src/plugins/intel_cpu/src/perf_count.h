@@ -27,6 +27,10 @@ public:
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
     uint32_t count() const { return num; }
 
+    // boundaries of the last measured iteration
+    std::chrono::high_resolution_clock::time_point startTime() const { return __start; }
+    std::chrono::high_resolution_clock::time_point finishTime() const { return __finish; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -628,6 +628,7 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
             METRIC_KEY(RANGE_FOR_STREAMS),
             METRIC_KEY(IMPORT_EXPORT_SUPPORT),
             ov::caching_properties.name(),
+            PluginConfigInternalParams::KEY_CACHING_WITH_MMAP,
         };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
@@ -662,6 +663,13 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
     } else if (name == ov::caching_properties) {
         std::vector<ov::PropertyName> cachingProperties = { METRIC_KEY(FULL_DEVICE_NAME) };
         return decltype(ov::caching_properties)::value_type(cachingProperties);
+    } else if (name == PluginConfigInternalParams::KEY_CACHING_WITH_MMAP) {
+#if defined(_WIN32)
+        // a mapped file can't be removed or rewritten on Windows, so the mapping would block the cleanup of the cache
+        return false;
+#else
+        return true;
+#endif
     }
 
     IE_CPU_PLUGIN_THROW() << "Unsupported metric key: " << name;
@@ -795,16 +803,25 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
                                             const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "ImportNetwork");
 
+    // the path to the cache file is passed by the core to map the weights instead of reading them
+    auto importConfig = config;
+    std::string blobPath;
+    const auto blobPathIt = importConfig.find(PluginConfigInternalParams::KEY_CACHED_BLOB_PATH);
+    if (blobPathIt != importConfig.end()) {
+        blobPath = blobPathIt->second;
+        importConfig.erase(blobPathIt);
+    }
+
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights, true);
-        });
+        }, blobPath);
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
     Config conf = engConfig;
-    conf.readProperties(config);
+    conf.readProperties(importConfig);
 
     // import config props from caching model
     auto function = cnnnetwork.getFunction();
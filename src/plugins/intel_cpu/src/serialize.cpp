@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/util/mmap_object.hpp>
 
 #include <pugixml.hpp>
 
@@ -12,6 +13,34 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 namespace {
+    // the weights section of the blob starts at the page boundary, so it can be mapped to memory as is
+    constexpr size_t weightsAlignment = 4096;
+
+    /*
+     * @brief Holds the memory mapped cache file while the weights blob is alive.
+     * The mapping is read-only, so the blob can be locked for reading only.
+     */
+    class MappedWeightsAllocator final : public IAllocator {
+        std::shared_ptr<ov::MappedMemory> _mapped;
+        char* _data;
+        size_t _size;
+
+    public:
+        MappedWeightsAllocator(std::shared_ptr<ov::MappedMemory> mapped, size_t offset, size_t size)
+            : _mapped(std::move(mapped)), _data(_mapped->data() + offset), _size(size) {}
+
+        void* lock(void* handle, LockOp op = LOCK_FOR_WRITE) noexcept override {
+            return handle == _data && op == LOCK_FOR_READ ? handle : nullptr;
+        }
+        void unlock(void*) noexcept override {}
+        void* alloc(size_t size) noexcept override {
+            return size <= _size ? _data : nullptr;
+        }
+        bool free(void*) noexcept override {
+            return false;
+        }
+    };
+
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -110,6 +139,11 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         }
 
         xml_doc.save(stream);
+
+        // pad the custom data up to the page boundary with zeros, which also terminate the xml string
+        const auto pos = static_cast<size_t>(stream.tellp());
+        const auto padding = (weightsAlignment - pos % weightsAlignment) % weightsAlignment;
+        stream.write(std::string(padding, '\0').c_str(), static_cast<std::streamsize>(padding));
     };
 
     // Serialize to old representation in case of old API
@@ -119,9 +153,10 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
-CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn, std::string blobPath)
     : _istream(istream)
-    , _cnn_network_builder(fn) {
+    , _cnn_network_builder(fn)
+    , _blobPath(std::move(blobPath)) {
 }
 
 void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network) {
@@ -146,10 +181,27 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        std::shared_ptr<ov::MappedMemory> mapped;
+        if (!_blobPath.empty() && hdr.consts_offset % weightsAlignment == 0) {
+            // the blob is the cache file, so the weights are used right from its mapping instead of being copied
+            try {
+                mapped = ov::load_mmap_object(_blobPath);
+            } catch (const std::runtime_error&) {
+                // fall back to reading the weights from the stream
+            }
+            if (mapped && mapped->size() < hdr.consts_offset + hdr.consts_size)
+                IE_THROW(NetworkNotRead) << "The weights section is out of the cache file " << _blobPath;
+        }
+        if (mapped) {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                desc, std::make_shared<MappedWeightsAllocator>(mapped, hdr.consts_offset, hdr.consts_size));
+            dataBlob->allocate();
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -27,12 +27,14 @@ public:
                 InferenceEngine::CNNNetwork(
                         const std::string&,
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
-    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
+    // the weights are mapped from the blob file, when its path is given, instead of being read from the stream
+    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn, std::string blobPath = {});
     void operator >> (InferenceEngine::CNNNetwork & network);
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::string _blobPath;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -95,6 +95,7 @@
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
+#include "ngraph_transformations/convert_matmul_to_fc_compressed.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -191,6 +192,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     const bool useLpt = !defaultPrecisions.empty();
     if (useLpt) {
         manager.register_pass<ov::pass::MarkDequantizationSubgraph>(defaultPrecisions);
+    } else {
+        // keep the compressed weights of MatMul till ConvertMatMulToFCCompressed
+        manager.register_pass<MarkMatMulCompressedWeights>();
     }
 
     auto get_convert_precisions = []() {
@@ -219,6 +223,12 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     manager.register_pass<ov::pass::CommonOptimizations>();
     manager.register_pass<ov::pass::WrapInterpolateIntoTransposes>();
     manager.register_pass<ov::pass::TransposeSinking>();
+    // TensorIterator and Loop with a single cell body and the chains of the unrolled cells are executed as the sequence
+    // primitive, which computes the input projection of all the time steps at once. Unsupported sequences are converted
+    // back by the next pass. MOCTransformations also converts TensorIterator, but it is run by the offline model
+    // conversion only, so the models read by the frontends directly reach the plugin with TensorIterator.
+    manager.register_pass<ov::pass::ConvertTensorIteratorToSequence>();
+    manager.register_pass<ov::pass::ConvertUnrolledCellsToSequence>();
     manager.register_pass<ov::pass::ConvertSequenceToTensorIterator>();
     manager.register_pass<ov::pass::ConvertOpSet3ToOpSet2>();
     manager.register_pass<ov::pass::ConvertOpSet2ToOpSet1>();
@@ -244,6 +254,10 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     }
     manager.register_pass<ov::pass::Validate>();
     manager.register_pass<ov::pass::ConvertPrecision>(precisions, type_to_fuse);
+    if (!useLpt) {
+        manager.register_pass<ConvertMatMulToFCCompressed>();
+        manager.register_pass<EnableMatMulCompressedWeightsFolding>();
+    }
     manager.register_pass<ov::pass::EliminateConvert>();
     manager.register_pass<SwapConvertTranspose>();
     manager.register_pass<ConvertToInteraction>();
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <climits>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind)
+
+namespace {
+// the values from linux/mempolicy.h, which is not necessarily installed
+constexpr int mpolPreferred = 1;
+constexpr int mpolInterleave = 3;
+
+bool mbind(void* data, size_t size, int mode, const std::vector<int>& numaNodes) {
+    constexpr size_t bitsPerMask = sizeof(unsigned long) * CHAR_BIT;
+
+    std::vector<unsigned long> nodeMask;
+    for (auto node : numaNodes) {
+        if (node < 0)
+            return false;
+        const auto idx = static_cast<size_t>(node) / bitsPerMask;
+        if (idx >= nodeMask.size())
+            nodeMask.resize(idx + 1, 0);
+        nodeMask[idx] |= 1ul << (static_cast<size_t>(node) % bitsPerMask);
+    }
+
+    // the kernel expects the number of the mask bits + 1, no flags are needed since the pages are not populated yet
+    const auto maxNode = nodeMask.size() * bitsPerMask + 1;
+    return syscall(SYS_mbind, data, size, mode, nodeMask.data(), maxNode, 0u) == 0;
+}
+}  // namespace
+
+void* allocateOnNumaNodes(size_t size, const std::vector<int>& numaNodes) {
+    if (size == 0 || numaNodes.empty())
+        return nullptr;
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+        return nullptr;
+    // the memory is still usable if the kernel doesn't support the binding, it just stays where it is touched first
+    mbind(data, size, numaNodes.size() == 1 ? mpolPreferred : mpolInterleave, numaNodes);
+    return data;
+}
+
+void freeOnNumaNodes(void* data, size_t size) {
+    if (data)
+        munmap(data, size);
+}
+
+#else
+
+void* allocateOnNumaNodes(size_t, const std::vector<int>&) {
+    return nullptr;
+}
+
+void freeOnNumaNodes(void*, size_t) {}
+
+#endif
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Allocates a page aligned memory region whose pages are placed on the given NUMA node (preferably, so the allocation
+ * doesn't fail when the node is out of memory) or interleaved over the given NUMA nodes.
+ * The policy is set for the whole region before its pages are touched, so no page is moved afterwards.
+ * The memory is left unbound if the kernel doesn't support the binding.
+ *
+ * @return nullptr if such allocation is not supported on the platform or failed
+ */
+void* allocateOnNumaNodes(size_t size, const std::vector<int>& numaNodes);
+
+/**
+ * Releases the memory region allocated by allocateOnNumaNodes
+ */
+void freeOnNumaNodes(void* data, size_t size);
+
+}   // namespace intel_cpu
+}   // namespace ov
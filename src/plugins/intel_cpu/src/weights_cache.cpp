@@ -3,6 +3,7 @@
 //
 
 #include "weights_cache.hpp"
+#include "nodes/common/cpu_memcpy.h"
 
 #include <ie_system_conf.h>
 #include <memory>
@@ -12,6 +13,8 @@ namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+WeightsSharing::WeightsSharing(std::vector<int> numaNodes) : numaNodes(std::move(numaNodes)) {}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -46,6 +49,8 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            if (newPtr && !numaNodes.empty())
+                newPtr = placeOnNumaNodes(newPtr, valid);
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -71,24 +76,138 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+MemoryPtr WeightsSharing::placeOnNumaNodes(const MemoryPtr& memory, bool copyData) const {
+    // the whole buffer is allocated on the nodes at once instead of moving the pages of the created object
+    MemoryPtr placed = std::make_shared<Memory>(memory->getEngine(),
+                                                std::unique_ptr<IMemoryMngr>(new MemoryMngrOnNumaNodes(numaNodes)));
+    placed->Create(memory->getDescPtr());
+    if (copyData)
+        cpu_memcpy(placed->GetData(), memory->GetData(), memory->GetSize());
+    return placed;
+}
+
+size_t WeightsSharing::getMemorySize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    size_t size = 0;
+    for (const auto& weights : sharedWeights) {
+        if (auto memory = weights.second->sharedMemory.lock())
+            size += memory->GetSize();
+    }
+    return size;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+    setPlacement(Placement::Replicate);
+}
+
+void NumaNodesWeights::setPlacement(Placement placement) {
+    std::lock_guard<std::mutex> lock(_guard);
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    _placement = placement;
+    _cache_map.clear();
+    _owner_node = -1;
+    _node_requests.clear();
+    switch (placement) {
+    case Placement::Replicate:
+        // the replicas are allocated on the node even if the threads creating them are not pinned
+        for (auto numa_id : numaNodes)
+            _cache_map[numa_id] = std::make_shared<WeightsSharing>(numaNodes.size() > 1 ? std::vector<int>{numa_id}
+                                                                                       : std::vector<int>{});
+        break;
+    case Placement::Share:
+    case Placement::Interleave: {
+        auto shared = placement == Placement::Interleave && numaNodes.size() > 1
+                          ? std::make_shared<WeightsSharing>(numaNodes)
+                          : std::make_shared<WeightsSharing>();
+        for (auto numa_id : numaNodes)
+            _cache_map[numa_id] = shared;
+        break;
+    }
+    }
+}
+
+void NumaNodesWeights::replicate() {
+    std::lock_guard<std::mutex> lock(_guard);
+    if (_placement != Placement::Share || _cache_map.size() < 2)
+        return;
+    const auto owner = _owner_node < 0 ? _cache_map.begin()->first : _owner_node;
+    for (auto& cache : _cache_map) {
+        if (cache.first != owner)
+            cache.second = std::make_shared<WeightsSharing>(std::vector<int>{cache.first});
+    }
+    _placement = Placement::Replicate;
+}
+
+NumaNodesWeights::Placement NumaNodesWeights::getBudgetPlacement(size_t weightsSize, size_t numaNodesNum, size_t budget) {
+    if (numaNodesNum < 2)
+        return Placement::Replicate;
+    // the first copy of the weights is needed anyway, only the rest are the replicas
+    const auto replicas = numaNodesNum - 1;
+    return weightsSize <= budget / replicas ? Placement::Replicate : Placement::Share;
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
+    std::lock_guard<std::mutex> lock(_guard);
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
         IE_THROW() << "Unknown numa node id " << numa_id;
+    if (_owner_node < 0)
+        _owner_node = numa_id;
+    _node_requests[numa_id]++;
     return found->second;
 }
 
 const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
+    std::lock_guard<std::mutex> lock(_guard);
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
         IE_THROW() << "Unknown numa node id " << numa_id;
     return found->second;
 }
 
+std::vector<uint64_t> NumaNodesWeights::getBytesPerNode() const {
+    std::lock_guard<std::mutex> lock(_guard);
+    std::vector<uint64_t> bytes;
+    if (_cache_map.empty())
+        return bytes;
+    bytes.reserve(_cache_map.size());
+    if (_placement == Placement::Replicate) {
+        for (const auto& cache : _cache_map)
+            bytes.push_back(cache.second->getMemorySize());
+        return bytes;
+    }
+    const uint64_t size = _cache_map.begin()->second->getMemorySize();
+    const auto owner = _owner_node < 0 ? _cache_map.begin()->first : _owner_node;
+    for (const auto& cache : _cache_map) {
+        if (_placement == Placement::Interleave)
+            bytes.push_back(size / _cache_map.size());
+        else
+            bytes.push_back(cache.first == owner ? size : 0);
+    }
+    return bytes;
+}
+
+uint64_t NumaNodesWeights::getBytes() const {
+    uint64_t bytes = 0;
+    for (auto nodeBytes : getBytesPerNode())
+        bytes += nodeBytes;
+    return bytes;
+}
+
+float NumaNodesWeights::getRemoteAccessRatio() const {
+    std::lock_guard<std::mutex> lock(_guard);
+    size_t requests = 0, remoteRequests = 0;
+    for (const auto& nodeRequests : _node_requests) {
+        requests += nodeRequests.second;
+        if (_placement == Placement::Share && nodeRequests.first != _owner_node)
+            remoteRequests += nodeRequests.second;
+    }
+    if (!requests)
+        return 0.0f;
+    if (_placement == Placement::Interleave)
+        return _cache_map.size() > 1 ? static_cast<float>(_cache_map.size() - 1) / _cache_map.size() : 0.0f;
+    return static_cast<float>(remoteRequests) / requests;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
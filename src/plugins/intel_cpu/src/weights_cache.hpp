@@ -13,6 +13,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -70,6 +71,10 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    WeightsSharing() = default;
+    // the created objects are placed on the given NUMA nodes (interleaved over them if there are several)
+    explicit WeightsSharing(std::vector<int> numaNodes);
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,11 +99,18 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    // the total size of the cached objects that are alive
+    size_t getMemorySize() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    // copies the created object to a buffer allocated on the NUMA nodes of the cache
+    MemoryPtr placeOnNumaNodes(const MemoryPtr& memory, bool copyData) const;
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::vector<int> numaNodes;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -109,13 +121,38 @@ protected:
  */
 class NumaNodesWeights {
 public:
+    enum class Placement {
+        Replicate,   // each NUMA node keeps own copy of the weights
+        Share,       // the weights are stored once, on the node of the stream which creates them first
+        Interleave,  // the weights are stored once, with the pages interleaved over all the nodes
+    };
+
     NumaNodesWeights();
 
+    // resets the caches, so must be called before they are used
+    void setPlacement(Placement placement);
+    // switches the shared weights to the replicated ones, the weights cached so far stay with the node requested them first
+    void replicate();
+    // the weights are replicated only if the copies for all the nodes but the first one fit into the budget
+    static Placement getBudgetPlacement(size_t weightsSize, size_t numaNodesNum, size_t budget);
+
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    // the bytes of the cached weights placed on each NUMA node, in the order of the node ids
+    std::vector<uint64_t> getBytesPerNode() const;
+    // the bytes of the cached weights of all the nodes
+    uint64_t getBytes() const;
+    // the estimated share of the weights accesses of the streams that go to the memory of the other NUMA nodes
+    float getRemoteAccessRatio() const;
+
 private:
+    Placement _placement = Placement::Replicate;
     std::map<int, WeightsSharing::Ptr> _cache_map;
+
+    mutable std::mutex _guard;
+    int _owner_node = -1;                  // the node that requested the shared weights first
+    std::map<int, size_t> _node_requests;  // the number of the cache requests (the streams graphs) per node
 };
 
 }   // namespace intel_cpu
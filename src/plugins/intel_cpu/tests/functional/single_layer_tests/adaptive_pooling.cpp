@@ -454,6 +454,70 @@ INSTANTIATE_TEST_SUITE_P(smoke_StaticAdaPoolMax5DLayoutTest, AdaPoolLayerCPUTest
                          AdaPoolLayerCPUTest::getTestCaseName);
 
 
+// the channels of nspc and blocked layouts are reduced by the jit kernel by whole vectors, the rest of them by the scalar tail
+const std::vector<std::vector<InputShape>> input4DWideChannelsShapeVector = {
+        {{{-1, 35, -1, -1}, {{1, 35, 5, 4}, {2, 35, 7, 3}, {1, 35, 5, 4}}}},
+        {{{{1, 3}, 32, {1, 10}, {1, 10}}, {{2, 32, 6, 6}, {1, 32, 3, 8}}}}
+};
+
+const std::vector<std::vector<InputShape>> input5DWideChannelsShapeVector = {
+        {{{-1, 35, -1, -1, -1}, {{1, 35, 2, 5, 2}, {2, 35, 4, 3, 5}, {1, 35, 2, 5, 2}}}},
+        {{{{1, 3}, 32, {1, 10}, {1, 10}, {1, 10}}, {{2, 32, 3, 6, 4}, {1, 32, 4, 2, 3}}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaPoolAvg4DWideChannelsTest, AdaPoolLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Combine(
+                                         ::testing::Combine(
+                                                 ::testing::ValuesIn(pooled4DVector),
+                                                 ::testing::ValuesIn(input4DWideChannelsShapeVector)),
+                                         ::testing::Values("avg"),
+                                         ::testing::Values(false),
+                                         ::testing::ValuesIn(netPrecisions),
+                                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                                 ::testing::ValuesIn(filterCPUInfoForDevice("4D", "avg"))),
+                         AdaPoolLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaPoolMax4DWideChannelsTest, AdaPoolLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Combine(
+                                         ::testing::Combine(
+                                                 ::testing::ValuesIn(pooled4DVector),
+                                                 ::testing::ValuesIn(input4DWideChannelsShapeVector)),
+                                         ::testing::Values("max"),
+                                         ::testing::Values(false),
+                                         ::testing::ValuesIn(netPrecisions),
+                                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                                 ::testing::ValuesIn(filterCPUInfoForDevice("4D", "max"))),
+                         AdaPoolLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaPoolAvg5DWideChannelsTest, AdaPoolLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Combine(
+                                         ::testing::Combine(
+                                                 ::testing::ValuesIn(pooled5DVector),
+                                                 ::testing::ValuesIn(input5DWideChannelsShapeVector)),
+                                         ::testing::Values("avg"),
+                                         ::testing::Values(false),
+                                         ::testing::ValuesIn(netPrecisions),
+                                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                                 ::testing::ValuesIn(filterCPUInfoForDevice("5D", "avg"))),
+                         AdaPoolLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AdaPoolMax5DWideChannelsTest, AdaPoolLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Combine(
+                                         ::testing::Combine(
+                                                 ::testing::ValuesIn(pooled5DVector),
+                                                 ::testing::ValuesIn(input5DWideChannelsShapeVector)),
+                                         ::testing::Values("max"),
+                                         ::testing::Values(false),
+                                         ::testing::ValuesIn(netPrecisions),
+                                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                                 ::testing::ValuesIn(filterCPUInfoForDevice("5D", "max"))),
+                         AdaPoolLayerCPUTest::getTestCaseName);
+
+
 // in 1-channel cases  {..., 1, 1, 1} shape cannot be correctly resolved on oneDnn level, so it was removed from instances
 
 const std::vector<std::vector<InputShape>> input3DShape1Channel = {
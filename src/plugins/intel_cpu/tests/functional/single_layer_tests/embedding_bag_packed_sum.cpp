@@ -11,6 +11,7 @@
 #include "shared_test_classes/base/layer_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "test_utils/cpu_test_utils.hpp"
+#include "ie_system_conf.h"
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -67,7 +68,14 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the f32 tables are summed up by the jit kernel, the bf16 ones need avx512_core and are converted to f32 otherwise
+        auto tableType = inType;
+        if (tableType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core())
+            tableType = ElementType::f32;
+        const bool isJit = (tableType == ElementType::f32 && InferenceEngine::with_cpu_x86_avx2()) || tableType == ElementType::bf16;
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", tableType);
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -147,5 +155,14 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+// the bf16 rows are accumulated in f32 and the sums are rounded to bf16 output
+INSTANTIATE_TEST_SUITE_P(smoke_BF16, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                embBagPackedSumArgSet,
+                ::testing::Values(ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -7,6 +7,7 @@
 #include "test_utils/fusing_test_utils.hpp"
 #include "shared_test_classes/single_layer/pooling.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ie_system_conf.h"
 
 using namespace ov::test;
 using namespace CPUTestUtils;
@@ -204,6 +205,18 @@ protected:
     }
 };
 
+// the indices output is consumed, so the node is executed by the native implementation instead of oneDNN
+class MaxPoolingV8WithIndicesLayerCPUTest : public MaxPoolingV8LayerCPUTest {
+protected:
+    void SetUp() override {
+        MaxPoolingV8LayerCPUTest::SetUp();
+        auto pooling = function->get_results()[0]->get_input_node_shared_ptr(0);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(pooling->output(0)),
+                                     std::make_shared<ngraph::opset3::Result>(pooling->output(1))};
+        function = std::make_shared<ngraph::Function>(results, function->get_parameters(), "MaxPoolingWithIndices");
+    }
+};
+
 TEST_P(PoolingLayerCPUTest, CompareWithRefs) {
     run();
     CheckPluginRelatedResults(compiledModel, "Pooling");
@@ -214,6 +227,11 @@ TEST_P(MaxPoolingV8LayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Pooling");
 }
 
+TEST_P(MaxPoolingV8WithIndicesLayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "Pooling");
+}
+
 namespace {
 
 const auto avx512 = CPUSpecificParams{{}, {}, {"jit_avx512"}, "jit_avx512"};
@@ -448,6 +466,51 @@ INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_4D_ref, MaxPoolingV8LayerCPUTest,
                                  ::testing::Values(ref)),
                          MaxPoolingV8LayerCPUTest::getTestCaseName);
 
+// the planar layout is executed by the reference code of the native implementation, nspc and blocked ones by its kernel
+const auto nativeMaxPoolV8Type = InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" :
+                                 InferenceEngine::with_cpu_x86_avx2() ? "jit_avx2" : "ref_any";
+
+std::vector<CPUSpecificParams> nativeMaxPoolV8Configs(const std::string& dims) {
+    const bool is5D = dims == "5D";
+    const auto planar = is5D ? ncdhw : nchw;
+    const auto nspc = is5D ? ndhwc : nhwc;
+    const auto blocked = InferenceEngine::with_cpu_x86_avx512_core() ? (is5D ? nCdhw16c : nChw16c) : (is5D ? nCdhw8c : nChw8c);
+    return {CPUSpecificParams{{planar}, {planar, planar}, {}, "ref_any"},
+            CPUSpecificParams{{nspc}, {nspc, nspc}, {}, nativeMaxPoolV8Type},
+            CPUSpecificParams{{blocked}, {blocked, blocked}, {}, nativeMaxPoolV8Type}};
+}
+
+// bf16 is kept by the native implementation only on avx512_core, otherwise the node is executed in f32
+std::vector<ElementType> nativeMaxPoolV8Precisions() {
+    if (InferenceEngine::with_cpu_x86_avx512_core())
+        return {ElementType::f32, ElementType::bf16};
+    return {ElementType::f32};
+}
+
+// the indices are flattened starting from the axis dimension
+const std::vector<LayerTestsDefinitions::maxPoolV8SpecificParams> paramsMaxV84D_WithIndices = {
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {2, 2}, {2, 2}, {2, 2}, {0, 0}, {0, 0},
+                                                        ngraph::element::Type_t::i32, 0,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::SAME_UPPER },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {4, 2}, {2, 2}, {1, 2}, {0, 0}, {0, 0},
+                                                        ngraph::element::Type_t::i32, 1,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::EXPLICIT },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {3, 3}, {2, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                        ngraph::element::Type_t::i32, 2,
+                                                        ngraph::op::RoundingType::FLOOR, ngraph::op::PadType::EXPLICIT },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {4, 2}, {2, 1}, {2, 2}, {0, 0}, {0, 0},
+                                                        ngraph::element::Type_t::i32, -3,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::EXPLICIT },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_4D_WithIndices, MaxPoolingV8WithIndicesLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(paramsMaxV84D_WithIndices),
+                                 ::testing::ValuesIn(inputShapes4D),
+                                 ::testing::ValuesIn(nativeMaxPoolV8Precisions()),
+                                 ::testing::ValuesIn(nativeMaxPoolV8Configs("4D"))),
+                         MaxPoolingV8WithIndicesLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_AvgPool_CPU_4D, PoolingLayerCPUTest,
                         ::testing::Combine(
                             ::testing::ValuesIn(paramsAvg4D),
@@ -574,6 +637,26 @@ INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_5D_ref, MaxPoolingV8LayerCPUTest,
                                  ::testing::Values(ref)),
                          MaxPoolingV8LayerCPUTest::getTestCaseName);
 
+const std::vector<LayerTestsDefinitions::maxPoolV8SpecificParams> paramsMaxV85D_WithIndices = {
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {2, 2, 2}, {1, 1, 1}, {2, 2, 2}, {1, 1, 1}, {1, 1, 1},
+                                                        ngraph::element::Type_t::i32, 0,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::EXPLICIT },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {2, 3, 4}, {2, 2, 2}, {2, 1, 1}, {1, 1, 1}, {1, 2, 2},
+                                                        ngraph::element::Type_t::i32, 2,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::EXPLICIT },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {3, 3, 3}, {2, 2, 2}, {1, 1, 1}, {0, 0, 0}, {0, 0, 0},
+                                                        ngraph::element::Type_t::i32, 1,
+                                                        ngraph::op::RoundingType::FLOOR, ngraph::op::PadType::SAME_LOWER },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_5D_WithIndices, MaxPoolingV8WithIndicesLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(paramsMaxV85D_WithIndices),
+                                 ::testing::ValuesIn(inputShapes5D),
+                                 ::testing::ValuesIn(nativeMaxPoolV8Precisions()),
+                                 ::testing::ValuesIn(nativeMaxPoolV8Configs("5D"))),
+                         MaxPoolingV8WithIndicesLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_AvgPool_CPU_5D, PoolingLayerCPUTest,
                          ::testing::Combine(
                               ::testing::ValuesIn(paramsAvg5D),
@@ -92,7 +92,8 @@ protected:
         std::tie(shapes, ssParams, secondaryInputType, dataType, cpuParams) = this->GetParam();
         std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
 
-        selectedType = makeSelectedTypeStr("ref", dataType);
+        // the in-place views are expected explicitly by the test instances, the other slices are executed
+        selectedType = makeSelectedTypeStr(selectedType.empty() ? "ref" : selectedType, dataType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
         std::vector<InputShape> input_shapes = {shapes};
 
@@ -147,6 +148,9 @@ const auto cpuParams_ndhwc = CPUSpecificParams {{ndhwc}, {ndhwc}, {}, {}};
 const auto cpuParams_nchw = CPUSpecificParams {{nchw}, {nchw}, {}, {}};
 const auto cpuParams_ncdhw = CPUSpecificParams {{ncdhw}, {ncdhw}, {}, {}};
 
+const auto cpuParams_nchw_inPlace = CPUSpecificParams {{nchw}, {nchw}, {}, "unknown"};
+const auto cpuParams_ncdhw_inPlace = CPUSpecificParams {{ncdhw}, {ncdhw}, {}, "unknown"};
+
 const std::vector<ElementType> inputPrecisions = {
         ElementType::f32,
         ElementType::bf16,
@@ -385,6 +389,36 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_Common_Dynamic_5D, StridedSliceLa
                                  ::testing::ValuesIn(CPUParamsCommon5D)),
                          StridedSliceLayerCPUTest::getTestCaseName);
 
+// the dense unit step slices of the static planar data, which are in-place views on the input memory
+const std::vector<StridedSliceParams> testCasesInPlace4D = {
+        StridedSliceParams{ { 0, 1, 0, 0 }, { 1, 4, 32, 32 }, { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 },  { },  { },  { } },
+        StridedSliceParams{ { 0, -2, 0, 0 }, { 1, 5, 32, 32 }, { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 },  { },  { },  { } },
+        StridedSliceParams{ { 0, 3, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, { 0, 1, 1, 1 },  { },  { },  { } },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_InPlace_Static_4D, StridedSliceLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(static_shapes_to_test_representation({{ 1, 5, 32, 32 }})),
+                                 ::testing::ValuesIn(testCasesInPlace4D),
+                                 ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                 ::testing::ValuesIn(inputPrecisions),
+                                 ::testing::Values(cpuParams_nchw_inPlace)),
+                         StridedSliceLayerCPUTest::getTestCaseName);
+
+const std::vector<StridedSliceParams> testCasesInPlace5D = {
+        StridedSliceParams{ { 0, 0, 0, 0, 0 }, { 1, 5, 20, 32, 32 }, { 1, 1, 1, 1, 1 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },  { },  { },  { } },
+        StridedSliceParams{ { 1, 0, 0, 0, 0 }, { 2, 5, 20, 32, 32 }, { 1, 1, 1, 1, 1 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },  { },  { },  { } },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_InPlace_Static_5D, StridedSliceLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(static_shapes_to_test_representation({{ 2, 5, 20, 32, 32 }})),
+                                 ::testing::ValuesIn(testCasesInPlace5D),
+                                 ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                 ::testing::ValuesIn(inputPrecisions),
+                                 ::testing::Values(cpuParams_ncdhw_inPlace)),
+                         StridedSliceLayerCPUTest::getTestCaseName);
+
 const std::vector<StridedSliceParams> testCasesBlocked5DSubset1 = {
         StridedSliceParams{ { 0, 0, 0, 5, 4 }, { 1, 16, 5, 28, 27 }, { 1, 1, 1, 1, 1 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },  { },  { },  { } },
         StridedSliceParams{ { 0, 0, 10, 0, 0 }, { 1, 16, 20, 32, 20 }, { 1, 1, 1, 1, 1 }, { 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0 },  { },  { },  { } },
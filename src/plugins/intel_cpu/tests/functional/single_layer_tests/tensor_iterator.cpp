@@ -141,6 +141,11 @@ std::vector<std::vector<InputShape>> inputs = {
                 {5, 5, 5}
             }
         },
+    },
+
+    {  //third test suit: static shapes, the body is bound to the contiguous chunks of the inputs and outputs
+        {{}, {{1, 12, 10}}},
+        {{}, {{1, 12, 10}}},
     }
 };
 
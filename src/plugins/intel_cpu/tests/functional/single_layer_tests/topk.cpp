@@ -389,6 +389,47 @@ INSTANTIATE_TEST_CASE_P(smoke_TopK_bubble_BLK_on_channel_horiz_dynamic, TopKLaye
         ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+// long rows which are split between the threads by the radix selection
+const std::vector<int64_t> k_radix = {50, 1024};
+
+std::vector<ov::test::InputShape> inputShapes_radix = {
+    {{}, {{1, 1, 2, 32000}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix = {
+    {{1, 1, {1, 2}, {16384, 50000}}, {{1, 1, 2, 32000}, {1, 1, 1, 50000}}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_dynamic, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(1),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapesDynamic_radix)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
 std::vector<ov::test::InputShape> inputShapes_top1 = {
     {{}, {{1, 1, 2, 1}}},
 };
@@ -193,7 +193,8 @@ std::vector<std::vector<InputShape>> getStaticShapes() {
         { { {}, { {4, 3, 2} } } },    // Static shapes
         { { {}, { {5, 1, 5} } } },    // Static shapes
         { { {}, { {100, 1, 1} } } },  // Static shapes
-        { { {}, { {5, 5, 5} } } }     // Static shapes
+        { { {}, { {5, 5, 5} } } },    // Static shapes
+        { { {}, { {4, 64, 256} } } }  // Static shapes, processed in parallel
     };
 
     return result;
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the requests of different batch sizes are packed by the auto-batching into one inference):
+/*
+ *   Parameter [?, 3, 8, 8]
+ *          |
+ *     Convolution
+ *          |
+ *         Relu
+ *          |
+ *   Result [?, 4, 8, 8]
+ */
+
+using AutoBatchingPackedRequestsParams = std::tuple<bool,   // the batch layout is set for the inputs/outputs
+                                                    bool>;  // the packing is allowed explicitly
+
+class AutoBatchingPackedRequests : public ::testing::TestWithParam<AutoBatchingPackedRequestsParams>,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchingPackedRequestsParams>& obj) {
+        bool batchLayout, packingAllowed;
+        std::tie(batchLayout, packingAllowed) = obj.param;
+        std::ostringstream result;
+        result << "batchLayout=" << batchLayout << "_packingAllowed=" << packingAllowed;
+        return result.str();
+    }
+};
+
+TEST_P(AutoBatchingPackedRequests, smoke_CompareWithUnpacked) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    bool batchLayout, packingAllowed;
+    std::tie(batchLayout, packingAllowed) = GetParam();
+
+    const auto type = ov::element::f32;
+    auto param = std::make_shared<ov::opset8::Parameter>(type, ov::PartialShape{-1, 3, 8, 8});
+    auto conv = ngraph::builder::makeConvolution(param, type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ov::op::PadType::EXPLICIT, 4);
+    auto relu = std::make_shared<ov::opset8::Relu>(conv);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    if (batchLayout) {
+        param->set_layout("NCHW");
+        result->set_layout("NCHW");
+    }
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    ov::Core core;
+    auto refModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    auto batchedModel = core.compile_model(model, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                                      CommonTestUtils::DEVICE_CPU + "(4)",
+                                           {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), "100"},
+                                            {PluginConfigInternalParams::KEY_AUTO_BATCH_PACK_DYNAMIC_REQUESTS,
+                                             packingAllowed ? PluginConfigParams::YES : PluginConfigParams::NO}});
+
+    // the requests of different batch sizes go to the same pack and must get their own part of the packed outputs back
+    const std::vector<size_t> batches{1, 3, 2, 4};
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> expected;
+    auto refRequest = refModel.create_infer_request();
+    for (size_t r = 0; r < batches.size(); r++) {
+        ov::Tensor input(type, ov::Shape{batches[r], 3, 8, 8});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>((i * 7 + r * 5) % 13) - 6.0f;
+
+        refRequest.set_input_tensor(input);
+        refRequest.infer();
+        const auto refOutput = refRequest.get_output_tensor();
+        expected.emplace_back(type, refOutput.get_shape());
+        refOutput.copy_to(expected.back());
+
+        requests.push_back(batchedModel.create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+
+    for (auto& request : requests)
+        request.start_async();
+    for (auto& request : requests)
+        request.wait();
+
+    for (size_t r = 0; r < batches.size(); r++) {
+        const auto output = requests[r].get_output_tensor();
+        ASSERT_EQ(output.get_shape(), expected[r].get_shape()) << "request " << r;
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_NEAR(output.data<float>()[i], expected[r].data<float>()[i], 1e-5f)
+                << "request " << r << ", element " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatchingPackedRequests, AutoBatchingPackedRequests,
+                         ::testing::Combine(::testing::Values(false, true),
+                                            ::testing::Values(false, true)),
+                         AutoBatchingPackedRequests::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <fstream>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the weights of the model imported from the cache are mapped from the cache file):
+/*
+ *     Parameter [2, 64]
+ *         |
+ *       MatMul <- Constant [64, 32]
+ *         |
+ *        Add <- Constant [32]
+ *         |
+ *       Result
+ */
+
+class CompiledBlobMmap : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::string getBlobFile(const std::string& cacheDir) {
+        const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+        EXPECT_EQ(blobs.size(), 1);
+        return blobs.empty() ? std::string{} : blobs.front();
+    }
+
+    // checks the memory mappings of the process for the file, only Linux exposes them
+    static bool isFileMapped(const std::string& path) {
+        const auto name = path.substr(path.find_last_of("/\\") + 1);
+        std::ifstream maps("/proc/self/maps");
+        std::string line;
+        while (!name.empty() && std::getline(maps, line)) {
+            if (line.size() > name.size() && line.compare(line.size() - name.size(), name.size(), name) == 0)
+                return true;
+        }
+        return false;
+    }
+};
+
+TEST_F(CompiledBlobMmap, smoke_CompareWithRef) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    std::vector<float> weightsData(64 * 32), biasData(32);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = static_cast<float>(i % 7) - 3.0f;
+    for (size_t i = 0; i < biasData.size(); i++)
+        biasData[i] = static_cast<float>(i % 3);
+    auto param = std::make_shared<ov::opset8::Parameter>(type, ov::Shape{2, 64});
+    auto weights = ov::opset8::Constant::create(type, ov::Shape{64, 32}, weightsData);
+    auto matMul = std::make_shared<ov::opset8::MatMul>(param, weights);
+    auto bias = ov::opset8::Constant::create(type, ov::Shape{32}, biasData);
+    auto add = std::make_shared<ov::opset8::Add>(matMul, bias);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(add)},
+                                             ov::ParameterVector{param});
+
+    const std::string cacheDir = "compiled_blob_mmap_cache";
+    ov::Core core;
+    core.set_property(ov::cache_dir(cacheDir));
+
+    ov::Tensor input(type, ov::Shape{2, 64});
+    auto inputData = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        inputData[i] = static_cast<float>(i % 5);
+
+    // the first compilation exports the model to the cache, the second one imports it
+    std::vector<std::vector<float>> outputs;
+    bool blobMapped = false;
+    for (size_t i = 0; i < 2; i++) {
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                                ov::hint::inference_precision(ov::element::f32));
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        auto output = request.get_output_tensor();
+        outputs.emplace_back(output.data<float>(), output.data<float>() + output.get_size());
+        if (i == 1)
+            blobMapped = isFileMapped(getBlobFile(cacheDir));
+    }
+    const auto blobFile = getBlobFile(cacheDir);
+#if defined(__linux__)
+    // the imported model keeps the cache file mapped while it is alive, and releases it then
+    EXPECT_TRUE(blobMapped);
+    EXPECT_FALSE(isFileMapped(blobFile));
+#else
+    // the mappings can be checked only on Linux
+    (void)blobMapped;
+#endif
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    std::remove(cacheDir.c_str());
+
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t j = 0; j < 32; j++) {
+            float ref = biasData[j];
+            for (size_t k = 0; k < 64; k++)
+                ref += inputData[i * 64 + k] * weightsData[k * 32 + j];
+            ASSERT_EQ(outputs[0][i * 32 + j], ref);
+            ASSERT_EQ(outputs[1][i * 32 + j], ref);
+        }
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
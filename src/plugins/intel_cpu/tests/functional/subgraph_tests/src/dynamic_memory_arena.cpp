@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <openvino/opsets/opset8.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the dynamic intermediate tensors are placed in one arena by the memory plan of their current sizes,
+// the input shapes shrink and grow again, so the arena is reused by the plans of the smaller shapes, then grows):
+/*
+ *                  Parameter [?, 3, ?, ?]
+ *                          |
+ *                   Convolution 3x3 (8)
+ *                          |
+ *                   Split (axis 1, in-place)
+ *                    /              \
+ *        Convolution 1x1 (4)         |
+ *                    \              /
+ *                         Add ---------------- Result
+ *                          |
+ *           Concat (axis 1, in-place) <- Split output 0
+ *                          |
+ *                     MaxPool 3x3
+ *                          |
+ *               Reshape [0, -1] (in-place)
+ *                          |
+ *                       Softmax
+ *                          |
+ *                        Result
+ */
+
+using DynamicMemoryArenaParams = std::string;  // CPU_SHAPES_CACHE_CAPACITY value
+
+class DynamicMemoryArenaCPUTest : public testing::WithParamInterface<DynamicMemoryArenaParams>,
+                                  virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicMemoryArenaParams>& obj) {
+        std::ostringstream result;
+        result << "shapesCacheCapacity=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_CAPACITY, GetParam()});
+
+        // the shapes shrink, grow above the previous maximum and repeat, so both the cached plans and the new ones
+        // are applied to the arena allocated for the other shapes
+        InputShape inputShape{{-1, 3, -1, -1},
+                              {{1, 3, 8, 8}, {2, 3, 32, 32}, {1, 3, 4, 4}, {2, 3, 32, 32},
+                               {1, 3, 16, 24}, {3, 3, 40, 40}, {1, 3, 8, 8}, {1, 3, 4, 4}}};
+        init_input_shapes({inputShape});
+
+        const auto type = ov::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(type, inputDynamicShapes);
+
+        auto conv = ngraph::builder::makeConvolution(params[0], type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 8);
+        auto split = std::make_shared<ov::opset8::Split>(conv, ov::opset8::Constant::create(ov::element::i64, {}, {1}), 2);
+        auto convBranch = ngraph::builder::makeConvolution(split->output(1), type, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                           ov::op::PadType::EXPLICIT, 4);
+        auto add = std::make_shared<ov::opset8::Add>(convBranch, split->output(1));
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{add, split->output(0)}, 1);
+        auto pool = std::make_shared<ov::opset8::MaxPool>(concat, ov::Strides{1, 1}, ov::Strides{1, 1},
+                                                          ov::Shape{1, 1}, ov::Shape{1, 1}, ov::Shape{3, 3});
+        auto reshape = std::make_shared<ov::opset8::Reshape>(pool->output(0),
+                                                             ov::opset8::Constant::create(ov::element::i64, {2}, {0, -1}),
+                                                             true);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(reshape, 1);
+
+        ov::ResultVector results{std::make_shared<ov::opset8::Result>(softmax), std::make_shared<ov::opset8::Result>(add)};
+        function = std::make_shared<ov::Model>(results, params, "DynamicMemoryArena");
+    }
+};
+
+TEST_P(DynamicMemoryArenaCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicMemoryArena, DynamicMemoryArenaCPUTest,
+                         ::testing::Values("100", "0"),
+                         DynamicMemoryArenaCPUTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,186 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the output shapes of the nodes are taken from the shapes cache for the repeated input shapes):
+/*
+ *     Parameter [1, ?, 16]
+ *         |
+ *        Add
+ *         |
+ *      Reshape [?, 16]
+ *         |
+ *       Relu
+ *         |
+ *       Result
+ */
+
+class DynamicShapesCache : public ::testing::Test, public CPUTestsBase {};
+
+TEST_F(DynamicShapesCache, smoke_CompareWithRef) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    auto param = std::make_shared<ov::opset8::Parameter>(type, ov::PartialShape{1, -1, 16});
+    auto bias = ov::opset8::Constant::create(type, ov::Shape{1}, {-1.0f});
+    auto add = std::make_shared<ov::opset8::Add>(param, bias);
+    auto shape = ov::opset8::Constant::create(ov::element::i64, ov::Shape{2}, {-1, 16});
+    auto reshape = std::make_shared<ov::opset8::Reshape>(add, shape, false);
+    auto relu = std::make_shared<ov::opset8::Relu>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                             ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{ov::num_streams.name(), 1}});
+    auto request = compiledModel.create_infer_request();
+
+    const std::vector<size_t> seqLengths{3, 7, 3, 7, 5, 3};
+    for (auto seqLen : seqLengths) {
+        ov::Tensor input(type, ov::Shape{1, seqLen, 16});
+        auto inputData = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            inputData[i] = static_cast<float>(i % 5);
+        request.set_input_tensor(input);
+        request.infer();
+
+        auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{seqLen, 16}));
+        auto outputData = output.data<float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(outputData[i], std::max(inputData[i] - 1.0f, 0.0f));
+    }
+
+    auto statistics = compiledModel.get_property(
+        InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_STATISTICS).as<std::vector<uint64_t>>();
+    ASSERT_EQ(statistics.size(), 2);
+    EXPECT_EQ(statistics[0], 3);  // hits
+    EXPECT_EQ(statistics[1], 3);  // misses
+}
+
+// Subgraph (the Reshape pattern is computed from the input shape, so the output shapes are still cached by the shapes):
+/*
+ *     Parameter [1, ?, 16]
+ *         |          \
+ *         |        ShapeOf
+ *         |          |
+ *         |        Gather   Constant [1]
+ *         |           \     /
+ *         |           Concat
+ *          \          /
+ *            Reshape [?, 16]
+ *               |
+ *             Relu
+ *               |
+ *             Result
+ */
+
+TEST_F(DynamicShapesCache, smoke_ShapeOfDependentShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    auto param = std::make_shared<ov::opset8::Parameter>(type, ov::PartialShape{1, -1, 16});
+    auto shapeOf = std::make_shared<ov::opset8::ShapeOf>(param);
+    auto seqLen = std::make_shared<ov::opset8::Gather>(shapeOf,
+                                                       ov::opset8::Constant::create(ov::element::i32, ov::Shape{1}, {1}),
+                                                       ov::opset8::Constant::create(ov::element::i32, ov::Shape{}, {0}));
+    auto pattern = std::make_shared<ov::opset8::Concat>(
+        ov::OutputVector{seqLen, ov::opset8::Constant::create(ov::element::i64, ov::Shape{1}, {16})}, 0);
+    auto reshape = std::make_shared<ov::opset8::Reshape>(param, pattern, false);
+    auto relu = std::make_shared<ov::opset8::Relu>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                             ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{ov::num_streams.name(), 1}});
+    auto request = compiledModel.create_infer_request();
+
+    const std::vector<size_t> seqLengths{3, 7, 3, 7, 5, 3};
+    for (auto seqLen : seqLengths) {
+        ov::Tensor input(type, ov::Shape{1, seqLen, 16});
+        auto inputData = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            inputData[i] = static_cast<float>(i % 5) - 2.0f;
+        request.set_input_tensor(input);
+        request.infer();
+
+        auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{seqLen, 16}));
+        auto outputData = output.data<float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(outputData[i], std::max(inputData[i], 0.0f));
+    }
+
+    auto statistics = compiledModel.get_property(
+        InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_STATISTICS).as<std::vector<uint64_t>>();
+    ASSERT_EQ(statistics.size(), 2);
+    EXPECT_EQ(statistics[0], 3);  // hits
+    EXPECT_EQ(statistics[1], 3);  // misses
+}
+
+// Subgraph (the Reshape pattern is a graph input, so its values are a part of the shapes cache key):
+/*
+ *     Parameter [?, ?]   Parameter [2]
+ *              \          /
+ *               Reshape
+ *                  |
+ *                Relu
+ *                  |
+ *                Result
+ */
+
+TEST_F(DynamicShapesCache, smoke_ValueDependentShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    auto param = std::make_shared<ov::opset8::Parameter>(type, ov::PartialShape{-1, -1});
+    auto pattern = std::make_shared<ov::opset8::Parameter>(ov::element::i64, ov::PartialShape{2});
+    auto reshape = std::make_shared<ov::opset8::Reshape>(param, pattern, false);
+    auto relu = std::make_shared<ov::opset8::Relu>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                             ov::ParameterVector{param, pattern});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{ov::num_streams.name(), 1}});
+    auto request = compiledModel.create_infer_request();
+
+    ov::Tensor input(type, ov::Shape{2, 12});
+    auto inputData = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        inputData[i] = static_cast<float>(i % 5) - 2.0f;
+    request.set_tensor(param, input);
+
+    // the input shapes are the same for all the inferences, only the pattern values change
+    const std::vector<ov::Shape> outputShapes{{3, 8}, {4, 6}, {3, 8}, {6, 4}, {4, 6}};
+    for (const auto& outputShape : outputShapes) {
+        ov::Tensor patternTensor(ov::element::i64, ov::Shape{2});
+        patternTensor.data<int64_t>()[0] = static_cast<int64_t>(outputShape[0]);
+        patternTensor.data<int64_t>()[1] = static_cast<int64_t>(outputShape[1]);
+        request.set_tensor(pattern, patternTensor);
+        request.infer();
+
+        auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), outputShape);
+        auto outputData = output.data<float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(outputData[i], std::max(inputData[i], 0.0f));
+    }
+
+    auto statistics = compiledModel.get_property(
+        InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHAPES_CACHE_STATISTICS).as<std::vector<uint64_t>>();
+    ASSERT_EQ(statistics.size(), 2);
+    EXPECT_EQ(statistics[0], 2);  // hits
+    EXPECT_EQ(statistics[1], 3);  // misses
+}
+
+}  // namespace SubgraphTestsDefinitions
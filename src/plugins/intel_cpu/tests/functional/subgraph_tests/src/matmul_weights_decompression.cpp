@@ -0,0 +1,177 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPUSubgraphTestsDefinitions {
+// Subgraph (the weights are decompressed inside FullyConnectedCompressed):
+/*
+ *                   Constant [O, G, I/G] or [G, I/G, O] (u8/i8/u4/i4)
+ *                       |
+ *                    Convert   Constant [O, G, 1] or [G, 1, O]
+ *                       \      /
+ *                       Subtract   Constant [O, G, 1] or [G, 1, O]
+ *                           \      /
+ *                           Multiply
+ *                              |
+ *   Parameter [?, ?, I]  Reshape [O, I] or [I, O] (absent for the plain [O, I] or [I, O] weights)
+ *   or [?, I]                  /
+ *                 \           /
+ *                    MatMul (transpose_b = true / false)
+ *                       |
+ *                    Result
+ */
+
+enum class DecompressionShape {
+    Plain,      // [O, I] weights, no Reshape
+    Reshaped,   // [O, 1, I] weights reshaped to [O, I]
+    Grouped     // [O, G, I/G] weights reshaped to [O, I]
+};
+
+std::ostream& operator<<(std::ostream& os, DecompressionShape shape) {
+    switch (shape) {
+    case DecompressionShape::Plain:
+        return os << "Plain";
+    case DecompressionShape::Reshaped:
+        return os << "Reshaped";
+    case DecompressionShape::Grouped:
+        return os << "Grouped";
+    }
+    return os;
+}
+
+using MatMulWeightsDecompressionParams = std::tuple<ElementType,         // weights precision
+                                                    DecompressionShape,  // decompression subgraph shape
+                                                    bool,                // transpose_b
+                                                    InputShape,          // activations shape
+                                                    ElementType>;        // inference precision
+
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   virtual public SubgraphBaseTest,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MatMulWeightsDecompressionParams>& obj) {
+        ElementType weightsType, inferencePrecision;
+        DecompressionShape decompressionShape;
+        bool transposeB;
+        InputShape inputShape;
+        std::tie(weightsType, decompressionShape, transposeB, inputShape, inferencePrecision) = obj.param;
+        std::ostringstream result;
+        result << "weightsType=" << weightsType << "_decompression=" << decompressionShape
+               << "_transposeB=" << transposeB << "_IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second)
+            result << CommonTestUtils::vec2str(shape) << "_";
+        result << "inferencePrecision=" << inferencePrecision;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        ElementType weightsType, inferencePrecision;
+        DecompressionShape decompressionShape;
+        bool transposeB;
+        InputShape inputShape;
+        std::tie(weightsType, decompressionShape, transposeB, inputShape, inferencePrecision) = GetParam();
+        configuration.insert({ov::hint::inference_precision.name(), inferencePrecision});
+        if (inferencePrecision == ov::element::bf16) {
+            abs_threshold = 0.1f;
+            rel_threshold = 0.05f;
+        }
+
+        const size_t O = 32, I = 64, G = decompressionShape == DecompressionShape::Grouped ? 4 : 1;
+        const bool isSigned = weightsType.is_signed();
+        const int range = weightsType.bitwidth() == 4 ? 16 : 256;
+        const int low = isSigned ? -range / 2 : 0;
+
+        std::vector<int> weightsData(O * I);
+        for (size_t i = 0; i < weightsData.size(); i++)
+            weightsData[i] = low + static_cast<int>((i * 7) % range);
+        std::vector<float> zeroPoints(O * G), scales(O * G);
+        for (size_t i = 0; i < O * G; i++) {
+            zeroPoints[i] = static_cast<float>(low + static_cast<int>(i % 5));
+            scales[i] = 0.01f * static_cast<float>(1 + i % 3);
+        }
+
+        const bool plain = decompressionShape == DecompressionShape::Plain;
+        const ov::Shape weightsShape = plain ? (transposeB ? ov::Shape{O, I} : ov::Shape{I, O})
+                                             : (transposeB ? ov::Shape{O, G, I / G} : ov::Shape{G, I / G, O});
+        const ov::Shape paramsShape = plain ? (transposeB ? ov::Shape{O, 1} : ov::Shape{1, O})
+                                            : (transposeB ? ov::Shape{O, G, 1} : ov::Shape{G, 1, O});
+        const std::vector<int64_t> decompressedShape = transposeB ? std::vector<int64_t>{O, I} : std::vector<int64_t>{I, O};
+
+        init_input_shapes({inputShape});
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto weights = ov::opset8::Constant::create(weightsType, weightsShape, weightsData);
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto zeroPoint = ov::opset8::Constant::create(ov::element::f32, paramsShape, zeroPoints);
+        auto subtract = std::make_shared<ov::opset8::Subtract>(convert, zeroPoint);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, paramsShape, scales);
+        auto multiply = std::make_shared<ov::opset8::Multiply>(subtract, scale);
+        std::shared_ptr<ov::Node> decompressed = multiply;
+        if (!plain) {
+            decompressed = std::make_shared<ov::opset8::Reshape>(
+                multiply, ov::opset8::Constant::create(ov::element::i64, ov::Shape{2}, decompressedShape), false);
+        }
+        auto matMul = std::make_shared<ov::opset8::MatMul>(param, decompressed, false, transposeB);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(matMul)},
+                                               ov::ParameterVector{param}, "MatMulWeightsDecompression");
+    }
+};
+
+TEST_P(MatMulWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (std::get<4>(GetParam()) == ov::element::bf16 && !InferenceEngine::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnectedCompressed", 1);
+}
+
+namespace {
+const std::vector<ElementType> weightsTypes = {ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4};
+
+const std::vector<DecompressionShape> decompressionShapes = {DecompressionShape::Plain,
+                                                             DecompressionShape::Reshaped,
+                                                             DecompressionShape::Grouped};
+
+const std::vector<InputShape> staticInputShapes = {{{}, {{2, 3, 64}}}, {{}, {{5, 64}}}};
+
+// the batches below and above 16 go through the row by row decompression kernel and the GEMM correspondingly
+const std::vector<InputShape> dynamicInputShapes = {
+    {{-1, -1, 64}, {{1, 1, 64}, {2, 20, 64}, {1, 7, 64}, {4, 64, 64}}},
+    {{-1, 64}, {{33, 64}, {3, 64}, {17, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(weightsTypes),
+                                            ::testing::ValuesIn(decompressionShapes),
+                                            ::testing::Values(false, true),
+                                            ::testing::ValuesIn(staticInputShapes),
+                                            ::testing::Values(ov::element::f32)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_Dynamic, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(weightsTypes),
+                                            ::testing::Values(DecompressionShape::Plain, DecompressionShape::Grouped),
+                                            ::testing::Values(true),
+                                            ::testing::ValuesIn(dynamicInputShapes),
+                                            ::testing::Values(ov::element::f32)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_BF16, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(ov::element::u8, ov::element::u4),
+                                            ::testing::Values(DecompressionShape::Grouped),
+                                            ::testing::Values(false, true),
+                                            ::testing::ValuesIn(dynamicInputShapes),
+                                            ::testing::Values(ov::element::bf16)),
+                         MatMulWeightsDecompression::getTestCaseName);
+}  // namespace
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ie_parallel.hpp"
+#include "openvino/op/op.hpp"
+#include "openvino/runtime/core.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (Inception-like block executed with the independent branches in parallel):
+/*
+ *                      Parameter
+ *           /        /           \          \
+ *       Conv1x1   Conv1x1      Conv1x1    MaxPool
+ *          |         |            |          |
+ *          |      Conv3x3      Conv3x3    Conv1x1
+ *          |         |            |          |
+ *          |         |         Conv3x3       |
+ *           \         \          /          /
+ *                       Concat
+ *                         |
+ *                       Result
+ */
+
+class ParallelBranchesExecutionTest : public testing::WithParamInterface<std::string>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "ParallelNodesExecution=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_NODES_EXECUTION, GetParam()});
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel, size_t outChannels) {
+            const ptrdiff_t pad = kernel / 2;
+            auto conv = builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                                 op::PadType::EXPLICIT, outChannels);
+            return std::make_shared<opset1::Relu>(conv);
+        };
+
+        auto branch0 = makeConv(inputParams[0], 1, 8);
+        auto branch1 = makeConv(makeConv(inputParams[0], 1, 8), 3, 8);
+        auto branch2 = makeConv(makeConv(makeConv(inputParams[0], 1, 4), 3, 8), 3, 8);
+        auto pool = builder::makePooling(inputParams[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch3 = makeConv(pool, 1, 8);
+
+        auto concat = builder::makeConcat({branch0, branch1, branch2, branch3}, 1);
+
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<Function>(results, inputParams, "ParallelBranchesExecution");
+    }
+};
+
+TEST_P(ParallelBranchesExecutionTest, CompareWithRefs) {
+    Run();
+}
+
+// Synthetic op which is executed by the reference implementation and detects the concurrent execution:
+// each call waits (no longer than the timeout) until the other calls start and records how many of them were active
+class OverlapProbe : public ov::op::Op {
+public:
+    OPENVINO_OP("OverlapProbe");
+
+    static std::atomic<size_t> active;
+    static std::atomic<size_t> maxActive;
+    static size_t expected;
+
+    OverlapProbe() = default;
+    OverlapProbe(const ov::Output<ov::Node>& arg) : Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        OPENVINO_ASSERT(new_args.size() == 1, "Incorrect number of new arguments");
+        return std::make_shared<OverlapProbe>(new_args[0]);
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        const auto current = ++active;
+        size_t observed = maxActive;
+        while (observed < current && !maxActive.compare_exchange_weak(observed, current)) {}
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (maxActive < expected && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        --active;
+
+        outputs[0].set_shape(inputs[0].get_shape());
+        memcpy(outputs[0].data(), inputs[0].data(), inputs[0].get_byte_size());
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& output_values,
+                  const ov::TensorVector& input_values,
+                  const ov::EvaluationContext& evaluationContext) const override {
+        return evaluate(output_values, input_values);
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+};
+
+std::atomic<size_t> OverlapProbe::active{0};
+std::atomic<size_t> OverlapProbe::maxActive{0};
+size_t OverlapProbe::expected = 0;
+
+// Subgraph (the probes of the independent branches must be executed at the same time):
+/*
+ *          Parameter
+ *        /     |     \
+ *    Probe   Probe   Probe
+ *        \     |     /
+ *            Concat
+ *              |
+ *            Result
+ */
+TEST(ParallelBranchesOverlapTest, smoke_IndependentNodesOverlap) {
+#if !(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    GTEST_SKIP() << "The nodes are executed in parallel with TBB only";
+#endif
+    const size_t branches = 3;
+    if (std::thread::hardware_concurrency() < branches)
+        GTEST_SKIP() << "Not enough threads to execute the branches in parallel";
+
+    auto param = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 8});
+    OutputVector probes;
+    for (size_t i = 0; i < branches; i++)
+        probes.push_back(std::make_shared<OverlapProbe>(param));
+    auto concat = std::make_shared<opset1::Concat>(probes, 1);
+    auto model = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(concat)},
+                                            ParameterVector{param}, "ParallelBranchesOverlap");
+
+    ov::Core core;
+    ov::Tensor input(element::f32, Shape{1, 8});
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+    for (const std::string parallel : {PluginConfigParams::YES, PluginConfigParams::NO}) {
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                                {{PluginConfigInternalParams::KEY_CPU_PARALLEL_NODES_EXECUTION, parallel},
+                                                 ov::inference_num_threads(static_cast<int>(branches))});
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        OverlapProbe::active = 0;
+        OverlapProbe::maxActive = 0;
+        OverlapProbe::expected = branches;
+        request.infer();
+        EXPECT_EQ(parallel == PluginConfigParams::YES ? branches : 1, OverlapProbe::maxActive.load()) << parallel;
+
+        const auto output = request.get_output_tensor();
+        ASSERT_EQ(branches * input.get_size(), output.get_size());
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(1.0f, output.data<float>()[i]);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranchesExecution, ParallelBranchesExecutionTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ParallelBranchesExecutionTest::getTestCaseName);
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
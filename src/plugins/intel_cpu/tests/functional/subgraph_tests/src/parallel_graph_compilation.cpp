@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Stress test for the parallel graph compilation: a large model with hundreds of branches of different kinds, so
+// the nodes sharing the same primitive cache keys, the weights cache and the scratch pads are initialized
+// concurrently, also by the graphs of several streams at once.
+/*
+ *                                        Parameter
+ *           /                /                |                    \                 \
+ *       Conv1x1          MaxPool          Multiply              MatMul      ...     (repeated)
+ *          |                |                 |                    |
+ *       Conv3x3          Conv1x1           Sigmoid                Relu
+ *          |                |                 |                    |
+ *         Add               |                Add                   |
+ *           \                \               |                   /
+ *                                          Concat
+ *                                            |
+ *                                          Result
+ */
+
+using ParallelGraphCompilationParams = std::tuple<std::string,  // CPU_PARALLEL_GRAPH_COMPILATION value
+                                                  std::string>;  // number of streams
+
+class ParallelGraphCompilationTest : public testing::WithParamInterface<ParallelGraphCompilationParams>,
+                                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ParallelGraphCompilationParams> obj) {
+        std::string parallelCompilation, streams;
+        std::tie(parallelCompilation, streams) = obj.param;
+        std::ostringstream result;
+        result << "ParallelGraphCompilation=" << parallelCompilation << "_streams=" << streams;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::string parallelCompilation, streams;
+        std::tie(parallelCompilation, streams) = GetParam();
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_COMPILATION, parallelCompilation});
+        configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams});
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 8, 7, 7}});
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel, size_t outChannels) {
+            const ptrdiff_t pad = kernel / 2;
+            auto conv = builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                                 op::PadType::EXPLICIT, outChannels);
+            return std::make_shared<opset1::Relu>(conv);
+        };
+
+        const size_t branchesNum = 256;
+        OutputVector branches;
+        for (size_t i = 0; i < branchesNum; i++) {
+            switch (i % 4) {
+            case 0: {
+                auto conv = makeConv(makeConv(inputParams[0], 1, 4), 3, 4);
+                auto bias = builder::makeConstant<float>(ngPrc, {1, 4, 1, 1}, {}, true);
+                branches.push_back(std::make_shared<opset1::Add>(conv, bias));
+                break;
+            }
+            case 1: {
+                auto pool = builder::makePooling(inputParams[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                                 op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+                branches.push_back(makeConv(pool, 1, 4));
+                break;
+            }
+            case 2: {
+                // the eltwise chain is tokenized into a snippets subgraph, which generates its kernel at the compilation
+                auto scale = builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+                auto shift = builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+                auto mul = std::make_shared<opset1::Multiply>(inputParams[0], scale);
+                branches.push_back(std::make_shared<opset1::Add>(std::make_shared<opset1::Sigmoid>(mul), shift));
+                break;
+            }
+            default: {
+                auto weights = builder::makeConstant<float>(ngPrc, {7, 7}, {}, true);
+                auto matMul = std::make_shared<opset1::MatMul>(inputParams[0], weights);
+                branches.push_back(std::make_shared<opset1::Relu>(matMul));
+                break;
+            }
+            }
+        }
+
+        auto concat = builder::makeConcat(branches, 1);
+
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<Function>(results, inputParams, "ParallelGraphCompilation");
+    }
+};
+
+TEST_P(ParallelGraphCompilationTest, CompareWithRefs) {
+    // compile the model several times to give the concurrent node initialization a chance to race
+    for (size_t i = 0; i < 5; i++) {
+        Run();
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelGraphCompilation, ParallelGraphCompilationTest,
+                         ::testing::Combine(::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                                            ::testing::Values("1", "4")),
+                         ParallelGraphCompilationTest::getTestCaseName);
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset5.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the RNN primitive may request another weights layout for each batch size, the weights are prepacked
+// once per layout and the prepacked weights are shared by all the streams):
+/*
+ *   Parameter X [?, 3, 32]   Parameter H [?, 1, 64]   Parameter C [?, 1, 64]   Parameter seq_lengths [?]
+ *                \                     |                       |                   /
+ *                          LSTMSequence <- Constants W, R, B
+ *                 /                    |                        \
+ *             Result Y             Result Ho                 Result Co
+ */
+
+class RNNPrepackedWeights : public ::testing::Test, public CPUTestsBase {};
+
+TEST_F(RNNPrepackedWeights, smoke_AlternatingBatchConcurrentStreams) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    const size_t seqLen = 3, inputSize = 32, hiddenSize = 64;
+    auto X = std::make_shared<ov::opset5::Parameter>(type, ov::PartialShape{-1, seqLen, inputSize});
+    auto H = std::make_shared<ov::opset5::Parameter>(type, ov::PartialShape{-1, 1, hiddenSize});
+    auto C = std::make_shared<ov::opset5::Parameter>(type, ov::PartialShape{-1, 1, hiddenSize});
+    auto seqLengths = std::make_shared<ov::opset5::Parameter>(ov::element::i64, ov::PartialShape{-1});
+
+    auto makeWeights = [&](const ov::Shape& shape, size_t seed) {
+        std::vector<float> values(ov::shape_size(shape));
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = 0.01f * static_cast<float>((i * 7 + seed) % 21) - 0.1f;
+        return ov::opset5::Constant::create(type, shape, values);
+    };
+    auto lstm = std::make_shared<ov::opset5::LSTMSequence>(X, H, C, seqLengths,
+                                                           makeWeights({1, 4 * hiddenSize, inputSize}, 1),
+                                                           makeWeights({1, 4 * hiddenSize, hiddenSize}, 2),
+                                                           makeWeights({1, 4 * hiddenSize}, 3),
+                                                           hiddenSize,
+                                                           ov::op::RecurrentSequenceDirection::FORWARD);
+    ov::ResultVector results;
+    for (const auto& output : lstm->outputs())
+        results.push_back(std::make_shared<ov::opset5::Result>(output));
+    auto model = std::make_shared<ov::Model>(results, ov::ParameterVector{X, H, C, seqLengths});
+
+    ov::Core core;
+    auto refModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                       {{ov::num_streams.name(), 1},
+                                        {ov::hint::inference_precision.name(), ov::element::f32}});
+    auto streamsModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                           {{ov::num_streams.name(), 2},
+                                            {ov::hint::inference_precision.name(), ov::element::f32}});
+
+    // the small and the large batches are interleaved, so the prepacked weights of every layout are reused
+    // after another layout was requested, and the streams with different batches run at the same time
+    const std::vector<size_t> batches{1, 64, 1, 64, 20, 1};
+    std::vector<ov::InferRequest> requests;
+    std::vector<std::vector<ov::Tensor>> expected;
+    auto refRequest = refModel.create_infer_request();
+    for (size_t r = 0; r < batches.size(); r++) {
+        const size_t batch = batches[r];
+        std::vector<ov::Tensor> inputs{ov::Tensor(type, {batch, seqLen, inputSize}),
+                                       ov::Tensor(type, {batch, 1, hiddenSize}),
+                                       ov::Tensor(type, {batch, 1, hiddenSize}),
+                                       ov::Tensor(ov::element::i64, {batch})};
+        for (size_t t = 0; t < 3; t++) {
+            for (size_t i = 0; i < inputs[t].get_size(); i++)
+                inputs[t].data<float>()[i] = 0.1f * static_cast<float>((i * 5 + r * 3 + t) % 13) - 0.6f;
+        }
+        std::fill_n(inputs[3].data<int64_t>(), batch, static_cast<int64_t>(seqLen));
+
+        requests.push_back(streamsModel.create_infer_request());
+        for (size_t i = 0; i < inputs.size(); i++) {
+            refRequest.set_input_tensor(i, inputs[i]);
+            requests.back().set_input_tensor(i, inputs[i]);
+        }
+        refRequest.infer();
+        expected.emplace_back();
+        for (size_t o = 0; o < results.size(); o++) {
+            const auto& refOutput = refRequest.get_output_tensor(o);
+            expected.back().emplace_back(type, refOutput.get_shape());
+            refOutput.copy_to(expected.back().back());
+        }
+    }
+
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            request.wait();
+        for (size_t r = 0; r < requests.size(); r++) {
+            for (size_t o = 0; o < results.size(); o++) {
+                const auto output = requests[r].get_output_tensor(o);
+                ASSERT_EQ(output.get_shape(), expected[r][o].get_shape());
+                for (size_t i = 0; i < output.get_size(); i++)
+                    ASSERT_NEAR(output.data<float>()[i], expected[r][o].data<float>()[i], 1e-5f)
+                        << "request " << r << ", output " << o << ", iteration " << iteration << ", element " << i;
+            }
+        }
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the DeformableConvolution executor is shared by all the streams and executed concurrently):
+/*
+ *   Parameter [1, 4, 8, 8]   Parameter [1, 18, 8, 8]
+ *              \              /
+ *           DeformableConvolution <- Constant [8, 4, 3, 3]
+ *                     |
+ *                   Result
+ */
+
+class SharedCacheDeformableConvolution : public ::testing::Test, public CPUTestsBase {};
+
+TEST_F(SharedCacheDeformableConvolution, smoke_ConcurrentStreams) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    const ov::Shape dataShape{1, 4, 8, 8}, offsetsShape{1, 18, 8, 8}, weightsShape{8, 4, 3, 3};
+    auto data = std::make_shared<ov::opset8::Parameter>(type, dataShape);
+    auto offsets = std::make_shared<ov::opset8::Parameter>(type, offsetsShape);
+    std::vector<float> weightsData(ov::shape_size(weightsShape));
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = 0.01f * static_cast<float>(i % 17) - 0.08f;
+    auto weights = ov::opset8::Constant::create(type, weightsShape, weightsData);
+    auto defConv = std::make_shared<ov::opset8::DeformableConvolution>(data, offsets, weights,
+                                                                       ov::Strides{1, 1},
+                                                                       ov::CoordinateDiff{1, 1},
+                                                                       ov::CoordinateDiff{1, 1},
+                                                                       ov::Strides{1, 1});
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(defConv)},
+                                             ov::ParameterVector{data, offsets});
+
+    ov::Core core;
+    auto refModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                       {{ov::num_streams.name(), 1},
+                                        {ov::hint::inference_precision.name(), ov::element::f32}});
+    auto sharedModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                          {{ov::num_streams.name(), 4},
+                                           {ov::hint::inference_precision.name(), ov::element::f32},
+                                           {PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING,
+                                            PluginConfigParams::YES}});
+
+    // each request samples the input at its own offsets, so the streams reading each other's sampling buffers
+    // produce wrong results
+    const size_t requestsNum = 8;
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> expected;
+    auto refRequest = refModel.create_infer_request();
+    for (size_t r = 0; r < requestsNum; r++) {
+        ov::Tensor dataTensor(type, dataShape), offsetsTensor(type, offsetsShape);
+        for (size_t i = 0; i < dataTensor.get_size(); i++)
+            dataTensor.data<float>()[i] = static_cast<float>((i * 7 + r * 3) % 11) - 5.0f;
+        for (size_t i = 0; i < offsetsTensor.get_size(); i++)
+            offsetsTensor.data<float>()[i] = 0.25f * static_cast<float>((i * 5 + r * 13) % 9) - 1.0f;
+
+        refRequest.set_input_tensor(0, dataTensor);
+        refRequest.set_input_tensor(1, offsetsTensor);
+        refRequest.infer();
+        const auto& refOutput = refRequest.get_output_tensor();
+        expected.emplace_back(type, refOutput.get_shape());
+        refOutput.copy_to(expected.back());
+
+        requests.push_back(sharedModel.create_infer_request());
+        requests.back().set_input_tensor(0, dataTensor);
+        requests.back().set_input_tensor(1, offsetsTensor);
+    }
+
+    for (size_t iteration = 0; iteration < 20; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            request.wait();
+        for (size_t r = 0; r < requestsNum; r++) {
+            const auto output = requests[r].get_output_tensor();
+            ASSERT_EQ(output.get_shape(), expected[r].get_shape());
+            for (size_t i = 0; i < output.get_size(); i++)
+                ASSERT_NEAR(output.data<float>()[i], expected[r].data<float>()[i], 1e-5f)
+                    << "request " << r << ", iteration " << iteration << ", element " << i;
+        }
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *          Parameter
+ *              |
+ *         StridedSlice (unit steps, in-place view if the slice is dense)
+ *           /       \
+ *      Consumer    Result
+ *         |
+ *       Result
+ *
+ *  This test is designed for correctness of the StridedSlice in-place implementation: the output is the view
+ *  on the input memory with the offset of the first sliced element. The consumer (MatMul, Concat or Eltwise)
+ *  reads the view directly and the Result gets the materialized slice. The slices which aren't dense
+ *  aren't in-place, since the consumers may read their inputs as contiguous.
+ */
+
+enum class SliceConsumer {
+    MatMul,
+    Concat,
+    Eltwise
+};
+
+std::ostream& operator<<(std::ostream& os, SliceConsumer consumer) {
+    switch (consumer) {
+    case SliceConsumer::MatMul: return os << "MatMul";
+    case SliceConsumer::Concat: return os << "Concat";
+    case SliceConsumer::Eltwise: return os << "Eltwise";
+    }
+    return os;
+}
+
+struct StridedSliceInPlaceParams {
+    ov::Shape inputShape;
+    std::vector<int64_t> begin;
+    std::vector<int64_t> end;
+    bool isView;
+};
+
+using StridedSliceInPlaceTestParams = std::tuple<StridedSliceInPlaceParams, SliceConsumer>;
+
+class StridedSliceInPlaceCPUTest : public testing::WithParamInterface<StridedSliceInPlaceTestParams>,
+                                   virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StridedSliceInPlaceTestParams>& obj) {
+        StridedSliceInPlaceParams params;
+        SliceConsumer consumer;
+        std::tie(params, consumer) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(params.inputShape) << "_";
+        result << "begin=" << CommonTestUtils::vec2str(params.begin) << "_";
+        result << "end=" << CommonTestUtils::vec2str(params.end) << "_";
+        result << "consumer=" << consumer;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        StridedSliceInPlaceParams params;
+        SliceConsumer consumer;
+        std::tie(params, consumer) = GetParam();
+        init_input_shapes({{{}, {params.inputShape}}});
+
+        auto inputParams = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const std::vector<int64_t> strides(params.begin.size(), 1);
+        const std::vector<int64_t> mask(params.begin.size(), 0);
+        auto ss = ngraph::builder::makeStridedSlice(inputParams[0], params.begin, params.end, strides, ov::element::f32, mask, mask);
+
+        const auto& sliceShape = ss->get_output_shape(0);
+        std::shared_ptr<ov::Node> consumerNode;
+        switch (consumer) {
+        case SliceConsumer::MatMul: {
+            auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {sliceShape.back(), 4}, {}, true);
+            consumerNode = std::make_shared<ov::op::v0::MatMul>(ss, weights);
+            break;
+        }
+        case SliceConsumer::Concat: {
+            auto other = ngraph::builder::makeConstant<float>(ov::element::f32, sliceShape, {}, true);
+            consumerNode = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{ss, other}, 1);
+            break;
+        }
+        case SliceConsumer::Eltwise: {
+            auto other = ngraph::builder::makeConstant<float>(ov::element::f32, sliceShape, {}, true);
+            consumerNode = std::make_shared<ov::op::v1::Add>(ss, other);
+            break;
+        }
+        }
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(consumerNode), std::make_shared<ov::op::v0::Result>(ss)};
+        function = std::make_shared<ov::Model>(results, inputParams, "StridedSliceInPlace");
+
+        selectedType = makeSelectedTypeStr(params.isView ? "unknown" : "ref", ov::element::f32);
+    }
+};
+
+TEST_P(StridedSliceInPlaceCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "StridedSlice");
+}
+
+namespace {
+
+const std::vector<StridedSliceInPlaceParams> params = {
+    // the slice is contiguous in the input memory
+    {{1, 8, 16, 32}, {0, 2, 0, 0}, {1, 6, 16, 32}, true},
+    // the slice along the sequence axis of the KV cache like tensor
+    {{1, 32, 4, 16}, {0, 8, 0, 0}, {1, 24, 4, 16}, true},
+    {{1, 32, 4, 16}, {0, -8, 0, 0}, {1, 32, 4, 16}, true},
+    // the slice along the outermost axis
+    {{6, 4, 10}, {1, 0, 0}, {4, 4, 10}, true},
+    // the slices of the inner axes aren't dense, so they are executed
+    {{1, 8, 16}, {0, 0, 4}, {1, 8, 8}, false},
+    {{2, 8, 16}, {0, 2, 0}, {2, 6, 16}, false},
+    {{2, 6, 10}, {0, 1, 2}, {2, 5, 8}, false},
+};
+
+const std::vector<SliceConsumer> consumers = {
+    SliceConsumer::MatMul,
+    SliceConsumer::Concat,
+    SliceConsumer::Eltwise,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_StridedSliceInPlace, StridedSliceInPlaceCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(params),
+                                            ::testing::ValuesIn(consumers)),
+                         StridedSliceInPlaceCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
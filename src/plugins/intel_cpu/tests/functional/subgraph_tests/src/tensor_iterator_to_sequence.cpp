@@ -0,0 +1,169 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset5.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the TensorIterator, the Loop or the unrolled cells are converted to the sequence node):
+/*
+ *      Parameter X [2, 5, 10]   Parameter H [2, 16]   (Parameter C [2, 16])
+ *                 \                  |                   /
+ *                    TensorIterator / Loop (axis 1)
+ *                  body: Squeeze -> LSTMCell/GRUCell -> Unsqueeze
+ *                 /                  |                   \
+ *             Result Y            Result Ho            (Result Co)
+ *
+ *  or the same cells unrolled over the time steps of Split(X, axis 1), Y is the Concat of their hidden states
+ */
+
+enum class RecurrentSubgraph {
+    TensorIterator,
+    Loop,
+    Unrolled
+};
+
+std::ostream& operator<<(std::ostream& os, RecurrentSubgraph subgraph) {
+    switch (subgraph) {
+    case RecurrentSubgraph::TensorIterator:
+        return os << "TensorIterator";
+    case RecurrentSubgraph::Loop:
+        return os << "Loop";
+    case RecurrentSubgraph::Unrolled:
+        return os << "Unrolled";
+    }
+    return os;
+}
+
+using TensorIteratorToSequenceParams = std::tuple<bool,                // LSTM cell if true, GRU cell otherwise
+                                                  RecurrentSubgraph>;  // how the time steps are expressed
+
+class TensorIteratorToSequenceCPUTest : public testing::WithParamInterface<TensorIteratorToSequenceParams>,
+                                        virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorToSequenceParams>& obj) {
+        bool isLstm;
+        RecurrentSubgraph subgraph;
+        std::tie(isLstm, subgraph) = obj.param;
+        std::ostringstream result;
+        result << "cell=" << (isLstm ? "LSTM" : "GRU") << "_subgraph=" << subgraph;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        bool isLstm;
+        RecurrentSubgraph subgraph;
+        std::tie(isLstm, subgraph) = GetParam();
+        const size_t batch = 2, seqLen = 5, inputSize = 10, hiddenSize = 16;
+        const size_t gates = isLstm ? 4 : 3;
+
+        std::vector<InputShape> shapes = {{{batch, seqLen, inputSize}, {{batch, seqLen, inputSize}}},
+                                          {{batch, hiddenSize}, {{batch, hiddenSize}}}};
+        if (isLstm)
+            shapes.push_back({{batch, hiddenSize}, {{batch, hiddenSize}}});
+        init_input_shapes(shapes);
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        auto W = ngraph::builder::makeConstant<float>(ov::element::f32, {gates * hiddenSize, inputSize}, {}, true, 0.5f, -0.5f);
+        auto R = ngraph::builder::makeConstant<float>(ov::element::f32, {gates * hiddenSize, hiddenSize}, {}, true, 0.5f, -0.5f);
+        auto B = ngraph::builder::makeConstant<float>(ov::element::f32, {gates * hiddenSize}, {}, true, 0.5f, -0.5f);
+        auto makeCell = [&](const ov::Output<ov::Node>& x, const ov::Output<ov::Node>& h, const ov::Output<ov::Node>& c) {
+            if (isLstm)
+                return std::static_pointer_cast<ov::Node>(std::make_shared<ov::opset5::LSTMCell>(x, h, c, W, R, B, hiddenSize));
+            return std::static_pointer_cast<ov::Node>(std::make_shared<ov::opset5::GRUCell>(x, h, W, R, B, hiddenSize));
+        };
+        auto axis = ov::opset5::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+
+        if (subgraph == RecurrentSubgraph::Unrolled) {
+            auto split = std::make_shared<ov::opset5::Split>(params[0], ov::opset5::Constant::create(ov::element::i64, ov::Shape{}, {1}), seqLen);
+            ov::Output<ov::Node> h = params[1];
+            ov::Output<ov::Node> c = isLstm ? params[2]->output(0) : ov::Output<ov::Node>();
+            ov::OutputVector hiddenStates;
+            for (size_t t = 0; t < seqLen; t++) {
+                auto cell = makeCell(std::make_shared<ov::opset5::Squeeze>(split->output(t), axis), h, c);
+                h = cell->output(0);
+                if (isLstm)
+                    c = cell->output(1);
+                hiddenStates.push_back(std::make_shared<ov::opset5::Unsqueeze>(h, axis));
+            }
+            ov::ResultVector results{std::make_shared<ov::opset5::Result>(std::make_shared<ov::opset5::Concat>(hiddenStates, 1)),
+                                     std::make_shared<ov::opset5::Result>(h)};
+            if (isLstm)
+                results.push_back(std::make_shared<ov::opset5::Result>(c));
+            function = std::make_shared<ov::Model>(results, params, "UnrolledCellsToSequence");
+            return;
+        }
+
+        auto bodyX = std::make_shared<ov::opset5::Parameter>(ov::element::f32, ov::Shape{batch, 1, inputSize});
+        auto bodyH = std::make_shared<ov::opset5::Parameter>(ov::element::f32, ov::Shape{batch, hiddenSize});
+        auto bodyC = std::make_shared<ov::opset5::Parameter>(ov::element::f32, ov::Shape{batch, hiddenSize});
+        auto squeeze = std::make_shared<ov::opset5::Squeeze>(bodyX, axis);
+
+        ov::ParameterVector bodyParams{bodyX, bodyH};
+        if (isLstm)
+            bodyParams.push_back(bodyC);
+        auto cell = makeCell(squeeze, bodyH, bodyC);
+        auto unsqueeze = std::make_shared<ov::opset5::Unsqueeze>(cell->output(0),
+                                                                 ov::opset5::Constant::create(ov::element::i64, ov::Shape{1}, {1}));
+
+        auto resY = std::make_shared<ov::opset5::Result>(unsqueeze);
+        auto resH = std::make_shared<ov::opset5::Result>(cell->output(0));
+        ov::ResultVector bodyResults{resY, resH};
+        std::shared_ptr<ov::opset5::Result> resC;
+        if (isLstm) {
+            resC = std::make_shared<ov::opset5::Result>(cell->output(1));
+            bodyResults.push_back(resC);
+        }
+
+        std::shared_ptr<ov::op::util::SubGraphOp> subgraphOp;
+        if (subgraph == RecurrentSubgraph::Loop) {
+            bodyResults.push_back(std::make_shared<ov::opset5::Result>(
+                ov::opset5::Constant::create(ov::element::boolean, ov::Shape{1}, {true})));
+            auto loop = std::make_shared<ov::opset5::Loop>(
+                ov::opset5::Constant::create(ov::element::i64, ov::Shape{}, {seqLen}),
+                ov::opset5::Constant::create(ov::element::boolean, ov::Shape{}, {true}));
+            loop->set_function(std::make_shared<ov::Model>(bodyResults, bodyParams));
+            loop->set_special_body_ports({-1, static_cast<int64_t>(bodyResults.size() - 1)});
+            subgraphOp = loop;
+        } else {
+            auto tensorIterator = std::make_shared<ov::opset5::TensorIterator>();
+            tensorIterator->set_body(std::make_shared<ov::Model>(bodyResults, bodyParams));
+            subgraphOp = tensorIterator;
+        }
+
+        subgraphOp->set_sliced_input(bodyX, params[0], 0, 1, 1, -1, 1);
+        subgraphOp->set_merged_input(bodyH, params[1], resH);
+        ov::ResultVector results{std::make_shared<ov::opset5::Result>(subgraphOp->get_concatenated_slices(resY, 0, 1, 1, -1, 1)),
+                                 std::make_shared<ov::opset5::Result>(subgraphOp->get_iter_value(resH, -1))};
+        if (isLstm) {
+            subgraphOp->set_merged_input(bodyC, params[2], resC);
+            results.push_back(std::make_shared<ov::opset5::Result>(subgraphOp->get_iter_value(resC, -1)));
+        }
+
+        function = std::make_shared<ov::Model>(results, params, "TensorIteratorToSequence");
+    }
+};
+
+TEST_P(TensorIteratorToSequenceCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "RNNSeq", 1);
+    CheckNumberOfNodesWithType(compiledModel, "RNNCell", 0);
+    CheckNumberOfNodesWithType(compiledModel, "TensorIterator", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorToSequence, TensorIteratorToSequenceCPUTest,
+                         ::testing::Combine(::testing::Values(true, false),
+                                            ::testing::Values(RecurrentSubgraph::TensorIterator,
+                                                              RecurrentSubgraph::Loop,
+                                                              RecurrentSubgraph::Unrolled)),
+                         TensorIteratorToSequenceCPUTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the state is read by a consumer and updated by a producer that writes directly into the state buffer):
+/*
+ *         ReadValue      Parameter
+ *          /     \          |
+ *   Multiply      \______  Add
+ *        |               \  |
+ *     Result              Add
+ *                          |
+ *                        Assign
+ */
+
+class VariableStateDoubleBuffer : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel(const ov::Shape& shape) {
+        const auto type = ov::element::f32;
+        auto param = std::make_shared<ov::opset8::Parameter>(type, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, type, "state"});
+        auto init = ov::opset8::Constant::create(type, shape, {0.0f});
+        auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        auto scale = ov::opset8::Constant::create(type, ov::Shape{1}, {2.0f});
+        auto mul = std::make_shared<ov::opset8::Multiply>(readValue, scale);
+        auto bias = ov::opset8::Constant::create(type, ov::Shape{1}, {1.0f});
+        auto add = std::make_shared<ov::opset8::Add>(param, bias);
+        auto update = std::make_shared<ov::opset8::Add>(readValue, add);
+        auto assign = std::make_shared<ov::opset8::Assign>(update, variable);
+        auto result = std::make_shared<ov::opset8::Result>(mul);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param});
+    }
+};
+
+TEST_F(VariableStateDoubleBuffer, smoke_CompareWithRef) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const ov::Shape shape{1, 64};
+    const size_t size = ov::shape_size(shape);
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(shape), CommonTestUtils::DEVICE_CPU);
+
+    // two requests share the same graph, but each one has its own state
+    std::vector<ov::InferRequest> requests{compiledModel.create_infer_request(), compiledModel.create_infer_request()};
+    std::vector<std::vector<float>> refStates(requests.size(), std::vector<float>(size, 0.0f));
+
+    const size_t iterations = 5;
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t r = 0; r < requests.size(); r++) {
+            auto& request = requests[r];
+            auto input = request.get_input_tensor();
+            auto inputData = input.data<float>();
+            for (size_t j = 0; j < size; j++)
+                inputData[j] = static_cast<float>(r + j % 3);
+
+            request.infer();
+
+            auto output = request.get_output_tensor().data<float>();
+            for (size_t j = 0; j < size; j++) {
+                ASSERT_EQ(output[j], 2.0f * refStates[r][j]);
+                refStates[r][j] += inputData[j] + 1.0f;
+            }
+
+            auto states = request.query_state();
+            ASSERT_EQ(states.size(), 1);
+            auto stateData = states.front().get_state().data<float>();
+            for (size_t j = 0; j < size; j++)
+                ASSERT_EQ(stateData[j], refStates[r][j]);
+        }
+    }
+
+    // the state set by the user is used in the next inference
+    auto& request = requests.front();
+    auto state = request.query_state().front();
+    ov::Tensor newState(ov::element::f32, shape);
+    std::fill_n(newState.data<float>(), size, 3.0f);
+    state.set_state(newState);
+    request.infer();
+    auto output = request.get_output_tensor().data<float>();
+    for (size_t j = 0; j < size; j++)
+        ASSERT_EQ(output[j], 6.0f);
+
+    state.reset();
+    request.infer();
+    output = request.get_output_tensor().data<float>();
+    for (size_t j = 0; j < size; j++)
+        ASSERT_EQ(output[j], 0.0f);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ie_system_conf.h"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the weights are placed on the NUMA nodes according to the replication policy):
+/*
+ *     Parameter [2, 64]
+ *         |
+ *       MatMul <- Constant [64, 32]
+ *         |
+ *       Result
+ */
+
+class WeightsReplication : public ::testing::TestWithParam<std::string>, public CPUTestsBase {};
+
+TEST_P(WeightsReplication, smoke_CompareWithRef) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto type = ov::element::f32;
+    auto param = std::make_shared<ov::opset8::Parameter>(type, ov::Shape{2, 64});
+    auto weights = ov::opset8::Constant::create(type, ov::Shape{64, 32}, std::vector<float>(64 * 32, 1.0f));
+    auto matMul = std::make_shared<ov::opset8::MatMul>(param, weights);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(matMul)},
+                                             ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{ov::num_streams.name(), 2},
+                                             {ov::hint::inference_precision.name(), ov::element::f32},
+                                             {PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION, GetParam()},
+                                             {PluginConfigInternalParams::KEY_CPU_WEIGHTS_REPLICATION_BUDGET, "1024"}});
+    auto request = compiledModel.create_infer_request();
+    ov::Tensor input(type, ov::Shape{2, 64});
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+    request.set_input_tensor(input);
+    request.infer();
+
+    auto output = request.get_output_tensor();
+    for (size_t i = 0; i < output.get_size(); i++)
+        ASSERT_EQ(output.data<float>()[i], 64.0f);
+
+    auto bytes = compiledModel.get_property(
+        PluginConfigInternalParams::KEY_CPU_WEIGHTS_BYTES_PER_NUMA_NODE).as<std::vector<uint64_t>>();
+    EXPECT_EQ(bytes.size(), getAvailableNUMANodes().size());
+    auto remoteRatio = compiledModel.get_property(
+        PluginConfigInternalParams::KEY_CPU_WEIGHTS_REMOTE_ACCESS_RATIO).as<float>();
+    EXPECT_GE(remoteRatio, 0.0f);
+    EXPECT_LE(remoteRatio, 1.0f);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsReplication, WeightsReplication,
+                         ::testing::Values(PluginConfigInternalParams::ALWAYS,
+                                           PluginConfigInternalParams::NEVER,
+                                           PluginConfigInternalParams::BUDGET,
+                                           PluginConfigInternalParams::INTERLEAVE));
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "nodes/common/box_iou.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace ov {
+namespace intel_cpu {
+// the scalar version of the cross compiled function, XARCH::box_iou is the dispatcher choosing the version for the host
+namespace ANY {
+float box_iou(const float* box, const float* boxes, size_t stride, size_t num, IouMode mode, float offset, float* iou);
+}  // namespace ANY
+}  // namespace intel_cpu
+}  // namespace ov
+
+namespace {
+
+float refIou(const float* a, const float* b, IouMode mode, float offset) {
+    if (mode != IouMode::Clamped) {
+        if (b[0] > a[2] || b[2] < a[0] || b[1] > a[3] || b[3] < a[1])
+            return 0.f;
+    } else if (a[4] <= 0.f || b[4] <= 0.f) {
+        return 0.f;
+    }
+    float side0 = std::min(a[2], b[2]) - std::max(a[0], b[0]) + offset;
+    float side1 = std::min(a[3], b[3]) - std::max(a[1], b[1]) + offset;
+    if (mode == IouMode::Clamped) {
+        side0 = std::max(side0, 0.f);
+        side1 = std::max(side1, 0.f);
+    } else if (mode == IouMode::Intersected && (side0 <= 0.f || side1 <= 0.f)) {
+        return 0.f;
+    }
+    const float inter = side0 * side1;
+    return inter / (a[4] + b[4] - inter);
+}
+
+}  // namespace
+
+class BoxIouTest : public testing::TestWithParam<IouMode> {};
+
+TEST_P(BoxIouTest, CompareWithScalar) {
+    const auto mode = GetParam();
+    std::default_random_engine random(1);
+    std::uniform_real_distribution<float> distribution(0.f, 10.f);
+
+    // the sizes cover the vector bodies and the tails of all the instruction sets
+    for (size_t num : {1, 7, 8, 15, 16, 17, 33, 100}) {
+        for (float offset : {0.f, 1.f}) {
+            const size_t stride = num + 3;
+            std::vector<float> boxes(boxIouComponents * stride);
+            auto fillBox = [&](float* dst, size_t step) {
+                const float min0 = distribution(random), min1 = distribution(random);
+                // some boxes are inverted to check the degenerate cases
+                dst[0] = min0;
+                dst[step] = min1;
+                dst[2 * step] = min0 + distribution(random) - 1.f;
+                dst[3 * step] = min1 + distribution(random) - 1.f;
+                dst[4 * step] = (dst[2 * step] - dst[0] + offset) * (dst[3 * step] - dst[step] + offset);
+            };
+            for (size_t j = 0; j < num; j++)
+                fillBox(&boxes[j], stride);
+            float box[boxIouComponents];
+            fillBox(box, 1);
+
+            std::vector<float> iou(num), scalarIou(num);
+            const float maxIou = XARCH::box_iou(box, boxes.data(), stride, num, mode, offset, iou.data());
+            ASSERT_EQ(maxIou, XARCH::box_iou(box, boxes.data(), stride, num, mode, offset, nullptr));
+            const float scalarMaxIou = ANY::box_iou(box, boxes.data(), stride, num, mode, offset, scalarIou.data());
+            ASSERT_NEAR(scalarMaxIou, maxIou, 1e-5f * std::max(1.f, std::abs(maxIou)));
+
+            float refMax = 0.f;
+            for (size_t j = 0; j < num; j++) {
+                float other[boxIouComponents];
+                for (size_t k = 0; k < boxIouComponents; k++)
+                    other[k] = boxes[k * stride + j];
+                const float ref = refIou(box, other, mode, offset);
+                refMax = std::max(refMax, ref);
+                ASSERT_NEAR(ref, iou[j], 1e-5f * std::max(1.f, std::abs(ref))) << "num=" << num << " j=" << j;
+                ASSERT_NEAR(ref, scalarIou[j], 1e-5f * std::max(1.f, std::abs(ref))) << "num=" << num << " j=" << j;
+            }
+            ASSERT_NEAR(refMax, maxIou, 1e-5f * std::max(1.f, std::abs(refMax)));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BoxIou, BoxIouTest,
+                         testing::Values(IouMode::Clamped, IouMode::Overlapped, IouMode::Intersected));
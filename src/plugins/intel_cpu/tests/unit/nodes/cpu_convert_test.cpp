@@ -0,0 +1,201 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_precision.hpp>
+#include <openvino/core/type/float16.hpp>
+#include "nodes/common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+
+float toFloat(const uint8_t* data, Precision prc, size_t i) {
+    switch (prc) {
+    case Precision::FP32: return reinterpret_cast<const float*>(data)[i];
+    case Precision::I32: return static_cast<float>(reinterpret_cast<const int32_t*>(data)[i]);
+    case Precision::FP16: return static_cast<float>(reinterpret_cast<const ov::float16*>(data)[i]);
+    case Precision::BF16: return static_cast<float>(reinterpret_cast<const bfloat16_t*>(data)[i]);
+    case Precision::U8: return static_cast<float>(data[i]);
+    case Precision::I8: return static_cast<float>(reinterpret_cast<const int8_t*>(data)[i]);
+    default: return 0.f;
+    }
+}
+
+void fromFloat(float value, uint8_t* data, Precision prc, size_t i) {
+    switch (prc) {
+    case Precision::FP32: reinterpret_cast<float*>(data)[i] = value; break;
+    case Precision::I32: reinterpret_cast<int32_t*>(data)[i] = static_cast<int32_t>(value); break;
+    case Precision::FP16: reinterpret_cast<ov::float16*>(data)[i] = static_cast<ov::float16>(value); break;
+    case Precision::BF16: reinterpret_cast<bfloat16_t*>(data)[i] = static_cast<bfloat16_t>(value); break;
+    case Precision::U8: data[i] = static_cast<uint8_t>(value); break;
+    case Precision::I8: reinterpret_cast<int8_t*>(data)[i] = static_cast<int8_t>(value); break;
+    default: break;
+    }
+}
+
+std::pair<double, double> limits(Precision prc) {
+    switch (prc) {
+    case Precision::I32: return {std::numeric_limits<int32_t>::lowest(), std::numeric_limits<int32_t>::max()};
+    case Precision::FP16: return {-65504., 65504.};
+    case Precision::BF16: return {std::numeric_limits<bfloat16_t>::lowest(), std::numeric_limits<bfloat16_t>::max()};
+    case Precision::U8: return {0., 255.};
+    case Precision::I8: return {-128., 127.};
+    default: return {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max()};
+    }
+}
+
+// The value of the float precision which is the closest to the limit from within, the integer values are exact
+float fitLimit(double limit, Precision prc) {
+    if (!prc.is_float())
+        return static_cast<float>(limit);
+    std::vector<uint8_t> data(prc.size());
+    fromFloat(static_cast<float>(limit), data.data(), prc, 0);
+    while (std::abs(static_cast<double>(toFloat(data.data(), prc, 0))) > std::abs(limit)) {
+        // the float types are sign-magnitude, so decreasing the bits decreases the magnitude
+        if (prc.size() == sizeof(uint16_t))
+            reinterpret_cast<uint16_t*>(data.data())[0]--;
+        else
+            reinterpret_cast<uint32_t*>(data.data())[0]--;
+    }
+    return toFloat(data.data(), prc, 0);
+}
+
+// The scalar conversion: the value is clamped to the limits of both precisions in the source precision (NaN is
+// passed through), truncated for the integer destination and rounded to the destination precision
+void convertRef(const uint8_t* src, uint8_t* dst, Precision srcPrc, Precision dstPrc, size_t i) {
+    // the same precision is copied, i32 values don't fit fp32
+    if (srcPrc == dstPrc) {
+        std::copy(src + i * srcPrc.size(), src + (i + 1) * srcPrc.size(), dst + i * dstPrc.size());
+        return;
+    }
+    float value = toFloat(src, srcPrc, i);
+    // f32 <-> bf16 aren't clamped
+    if (!(srcPrc == Precision::FP32 && dstPrc == Precision::BF16) &&
+        !(srcPrc == Precision::BF16 && dstPrc == Precision::FP32)) {
+        const auto lbound = fitLimit(std::max(limits(srcPrc).first, limits(dstPrc).first), srcPrc);
+        const auto ubound = fitLimit(std::min(limits(srcPrc).second, limits(dstPrc).second), srcPrc);
+        value = std::max(std::min(value, ubound), lbound);
+    }
+    fromFloat(dstPrc.is_float() ? value : std::trunc(value), dst, dstPrc, i);
+}
+
+bool equalValues(float lhs, float rhs) {
+    return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+}
+
+// NaN, infinities, the limits of the precisions and the values around them
+std::vector<uint8_t> specialValues(Precision prc, size_t& count) {
+    std::vector<uint8_t> data;
+    auto fill = [&](const std::vector<double>& values) {
+        count = values.size();
+        data.resize(count * prc.size());
+        for (size_t i = 0; i < count; i++) {
+            if (prc == Precision::I32)
+                reinterpret_cast<int32_t*>(data.data())[i] = static_cast<int32_t>(values[i]);
+            else
+                fromFloat(static_cast<float>(values[i]), data.data(), prc, i);
+        }
+    };
+    const double inf = std::numeric_limits<double>::infinity();
+    switch (prc) {
+    case Precision::I32:
+        // the full range, including the values which aren't exact in fp32
+        fill({-2147483648., -2147483647., -2147483520., -16777217., -65505., -129., -128., -1., 0., 1., 127., 128.,
+              255., 256., 65504., 65505., 16777217., 2147483520., 2147483583., 2147483647.});
+        break;
+    case Precision::U8:
+        fill({0., 1., 127., 128., 254., 255.});
+        break;
+    case Precision::I8:
+        fill({-128., -127., -1., 0., 1., 126., 127.});
+        break;
+    default:
+        fill({std::numeric_limits<double>::quiet_NaN(), inf, -inf, 0., -0., 0.5, -0.5, 1.5, -1.5, 2.5, 127.5, -128.5,
+              -129., 255.5, 256., -1., 65504., -65504., 65519., 65520., -65520., 3e9, -3e9,
+              std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()});
+        break;
+    }
+    return data;
+}
+}  // namespace
+
+using CpuConvertParams = std::tuple<Precision, Precision>;
+
+class CpuConvertTest : public testing::TestWithParam<CpuConvertParams> {};
+
+TEST_P(CpuConvertTest, CompareWithScalar) {
+    Precision srcPrc, dstPrc;
+    std::tie(srcPrc, dstPrc) = GetParam();
+    std::default_random_engine random(1);
+    std::uniform_real_distribution<float> distribution(-300.f, 300.f);
+
+    // the sizes cover the vector body, the tail and several parallel blocks
+    for (size_t size : {1, 7, 8, 17, 40003}) {
+        std::vector<uint8_t> src(size * srcPrc.size());
+        for (size_t i = 0; i < size; i++)
+            fromFloat(std::max(std::min(distribution(random), fitLimit(limits(srcPrc).second, srcPrc)),
+                               fitLimit(limits(srcPrc).first, srcPrc)),
+                      src.data(), srcPrc, i);
+
+        std::vector<uint8_t> dst(size * dstPrc.size());
+        cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+        std::vector<uint8_t> ref(size * dstPrc.size());
+        for (size_t i = 0; i < size; i++)
+            convertRef(src.data(), ref.data(), srcPrc, dstPrc, i);
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(toFloat(ref.data(), dstPrc, i), toFloat(dst.data(), dstPrc, i)) << "size=" << size << " i=" << i;
+    }
+}
+
+TEST_P(CpuConvertTest, SpecialValues) {
+    Precision srcPrc, dstPrc;
+    std::tie(srcPrc, dstPrc) = GetParam();
+    size_t count = 0;
+    const auto values = specialValues(srcPrc, count);
+
+    // the values are repeated, so they are converted both by the vector body and by the tail
+    const size_t size = 3 * count;
+    std::vector<uint8_t> src(size * srcPrc.size());
+    for (size_t i = 0; i < 3; i++)
+        std::copy(values.begin(), values.end(), src.begin() + i * values.size());
+
+    std::vector<uint8_t> dst(size * dstPrc.size());
+    cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+    std::vector<uint8_t> ref(size * dstPrc.size());
+    for (size_t i = 0; i < size; i++) {
+        // the conversion of NaN to the integer precisions is undefined
+        if (!dstPrc.is_float() && std::isnan(toFloat(src.data(), srcPrc, i)))
+            continue;
+        convertRef(src.data(), ref.data(), srcPrc, dstPrc, i);
+        if (dstPrc == Precision::I32) {
+            ASSERT_EQ(reinterpret_cast<const int32_t*>(ref.data())[i], reinterpret_cast<const int32_t*>(dst.data())[i])
+                << "i=" << i << " src=" << toFloat(src.data(), srcPrc, i);
+            continue;
+        }
+        ASSERT_TRUE(equalValues(toFloat(ref.data(), dstPrc, i), toFloat(dst.data(), dstPrc, i)))
+            << "i=" << i << " src=" << toFloat(src.data(), srcPrc, i) << " ref=" << toFloat(ref.data(), dstPrc, i)
+            << " dst=" << toFloat(dst.data(), dstPrc, i);
+    }
+}
+
+namespace {
+
+const std::vector<Precision> precisions = {
+    Precision::FP32, Precision::I32, Precision::FP16, Precision::BF16, Precision::U8, Precision::I8
+};
+
+}  // namespace
+
+INSTANTIATE_TEST_SUITE_P(smoke_CpuConvert, CpuConvertTest,
+                         testing::Combine(testing::ValuesIn(precisions), testing::ValuesIn(precisions)));
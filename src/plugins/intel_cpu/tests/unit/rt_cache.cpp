@@ -379,3 +379,37 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SmokeSharedCacheSync) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (size_t i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{static_cast<int>(i)}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, static_cast<int>(i));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // all the values have been stored by one of the threads
+    for (size_t i = 0; i < capacity; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{static_cast<int>(i)}, intBuilder);
+        ASSERT_EQ(*intResult.first, static_cast<int>(i));
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
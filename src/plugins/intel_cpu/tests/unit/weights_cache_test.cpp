@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <ie_system_conf.h>
+#include <cpu_memory.h>
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+using Placement = NumaNodesWeights::Placement;
+
+TEST(WeightsPlacementTest, BudgetPlacement) {
+    // a single node doesn't need replicas at all
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(1000, 1, 0), Placement::Replicate);
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(0, 2, 0), Placement::Replicate);
+
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(1000, 2, 1000), Placement::Replicate);
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(1001, 2, 1000), Placement::Share);
+    // only the copies for the nodes but the first one are counted
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(100, 4, 300), Placement::Replicate);
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(100, 4, 299), Placement::Share);
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(SIZE_MAX / 2, 3, SIZE_MAX), Placement::Replicate);
+    EXPECT_EQ(NumaNodesWeights::getBudgetPlacement(SIZE_MAX / 2 + 1, 3, SIZE_MAX), Placement::Share);
+}
+
+TEST(WeightsPlacementTest, ReplicateKeepsCachedWeights) {
+    const auto numaNodes = getAvailableNUMANodes();
+    ASSERT_FALSE(numaNodes.empty());
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{16, 16});
+
+    NumaNodesWeights weights;
+    weights.setPlacement(Placement::Share);
+    auto ownerCache = weights[numaNodes.front()];
+    MemoryPtr memory = *ownerCache->findOrCreate("weights", [&] {
+        MemoryPtr ptr = std::make_shared<Memory>(eng);
+        ptr->Create(desc);
+        return ptr;
+    });
+    // the other nodes use the cache of the first one while the weights are shared
+    for (auto node : numaNodes)
+        EXPECT_EQ(weights[node], ownerCache);
+    EXPECT_EQ(weights.getBytes(), memory->GetSize());
+
+    weights.replicate();
+    // the weights cached so far stay with the owner node, the rest of the nodes get their own caches
+    EXPECT_EQ(weights[numaNodes.front()], ownerCache);
+    EXPECT_EQ(static_cast<MemoryPtr>(*ownerCache->get("weights")), memory);
+    for (size_t i = 1; i < numaNodes.size(); i++)
+        EXPECT_NE(weights[numaNodes[i]], ownerCache);
+    EXPECT_EQ(weights.getBytes(), memory->GetSize());
+    EXPECT_EQ(weights.getRemoteAccessRatio(), 0.0f);
+}
+
+TEST(WeightsPlacementTest, MemoryOnNumaNodes) {
+    const auto numaNodes = getAvailableNUMANodes();
+    ASSERT_FALSE(numaNodes.empty());
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{3, 1000});
+
+    Memory memory(eng, std::unique_ptr<IMemoryMngr>(new MemoryMngrOnNumaNodes(numaNodes)));
+    memory.Create(desc);
+    ASSERT_NE(memory.GetData(), nullptr);
+    EXPECT_FALSE(memory.isUsedExternalStorage());
+    std::memset(memory.GetData(), 0x5a, memory.GetSize());
+    EXPECT_EQ(static_cast<uint8_t*>(memory.GetData())[memory.GetSize() - 1], 0x5a);
+
+    // the smaller shape reuses the buffer
+    auto data = memory.GetData();
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{2, 1000}));
+    EXPECT_EQ(memory.GetData(), data);
+}